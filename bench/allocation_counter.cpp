@@ -0,0 +1,53 @@
+#include <cstdlib>
+#include <new>
+#include "allocation_counter.h"
+
+std::atomic<uint64_t> allocation_counter{0};
+
+/**
+ * Allocates the memory of all the replaced operators new and counts the allocation
+ * The operators only call these helpers, which are never inlined, so the compiler doesn't see malloc() and free()
+ * paired with new and delete in the callers (-Wmismatched-new-delete)
+ * @param size Size of the allocation
+ * @return Allocated memory
+ */
+[[gnu::noinline]] static void *allocate(size_t size) {
+    allocation_counter.fetch_add(1, std::memory_order_relaxed);
+    if (void *memory = std::malloc(size ? size : 1))
+        return memory;
+    throw std::bad_alloc();
+}
+
+/**
+ * Frees the memory of all the replaced operators delete
+ * @param memory Memory allocated by allocate()
+ */
+[[gnu::noinline]] static void deallocate(void *memory) noexcept {
+    std::free(memory);
+}
+
+// Over-aligned allocations keep the default operators (they don't go through these ones and are not counted)
+
+void *operator new(size_t size) {
+    return allocate(size);
+}
+
+void *operator new[](size_t size) {
+    return allocate(size);
+}
+
+void operator delete(void *memory) noexcept {
+    deallocate(memory);
+}
+
+void operator delete[](void *memory) noexcept {
+    deallocate(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept {
+    deallocate(memory);
+}
+
+void operator delete[](void *memory, size_t) noexcept {
+    deallocate(memory);
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Number of heap allocations since the start of the program
+ * Counted by the replaced global operator new in allocation_counter.cpp, so the benchmark has to link the
+ * allocation_counter target (the replacement must not be defined more than once per program)
+ */
+extern std::atomic<uint64_t> allocation_counter;
+
+/**
+ * Returns the number of heap allocations since the start of the program
+ * @return Number of allocations
+ */
+inline uint64_t allocation_count() {
+    return allocation_counter.load(std::memory_order_relaxed);
+}
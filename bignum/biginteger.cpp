@@ -19,36 +19,79 @@
 
 #include <cstring>
 #include <cstdlib>
+#include <cstdio>
 #include <sstream>
 
 #include "biginteger.h"
 
-std::ostream& operator<<(std::ostream& s, const BigInteger& number) {
-    //write BigInteger
-    if (number.size == 0) { //number is zero
-        s << "0";
-        return s;
+void printSmall(std::ostream& s, const BigInteger& number, long width) {
+    //write absolute value of number, padded with zeroes to width digits
+    if (number.size == 0) {
+        for (long i = 1; i < width; i++)
+            s.put('0');
+        s.put('0');
+        return;
     }
     const int divValue = 6; //used for make required space for printed string
     long newLength = number.size + number.size/divValue + 1;
     digit *newLong = new digit [newLength];
-    if (number.sign)
-        s << "-";
     BigInteger A(number);
-    for(long i = 0; i < newLength; i++)
-        tinyDivide(A, A, BigInteger::Base2, newLong[i]);
-    while (newLong[newLength - 1] == 0)
-         newLength--;
-    s << newLong[newLength - 1];
-    for(long i = newLength - 2; i >= 0; i--) {
-        digit temp = newLong[i], power = BigInteger::Base2 / 10;
-        for (digit j = 0; j < BigInteger::Base2Log; j++) {
-            s << temp / power;
-            temp %= power;
-            power /= 10;
+    newLength = 0;
+    while (A.size > 0) //stop at zero, tinyDivide needs at least one digit
+        tinyDivide(A, A, BigInteger::Base2, newLong[newLength++]);
+    char buffer[BigInteger::Base2Log + 1];
+    int length = snprintf(buffer, sizeof(buffer), "%u", newLong[newLength - 1]);
+    for (long i = length + (newLength - 1)*BigInteger::Base2Log; i < width; i++)
+        s.put('0');
+    s.write(buffer, length);
+    std::string block((newLength - 1)*BigInteger::Base2Log, '0');
+    for(long i = newLength - 2, pos = 0; i >= 0; i--, pos += BigInteger::Base2Log) {
+        digit temp = newLong[i];
+        for (long j = BigInteger::Base2Log - 1; j >= 0; j--) {
+            block[pos + j] = '0' + temp % 10;
+            temp /= 10;
         }
     }
+    s.write(block.data(), block.size());
     delete [] newLong;
+}
+
+void printRange(std::ostream& s, const BigInteger& number, long width,
+                std::vector<BigInteger>& powers, std::vector<long>& powerDigits) {
+    //write absolute value of number padded to width digits, splitting by cached powers 10^(PrintSplitMin*2^k)
+    if (number.size <= BigInteger::PrintSplitMin) {
+        printSmall(s, number, width);
+        return;
+    }
+    if (powers.empty()) {
+        powers.push_back(pow(BigInteger(10), BigInteger::PrintSplitMin*BigInteger::Base2Log));
+        powerDigits.push_back(BigInteger::PrintSplitMin*BigInteger::Base2Log);
+    }
+    //the largest cached power with at most half of the digits of number is used (always smaller than number)
+    while (powers.back().size*2 <= number.size) {
+        powers.push_back(powers.back()*powers.back());
+        powerDigits.push_back(powerDigits.back()*2);
+    }
+    size_t k = powers.size() - 1;
+    while (k > 0 && powers[k].size*2 > number.size + 1)
+        k--;
+    BigInteger Q, R;
+    bigDivide(number, powers[k], Q, R);
+    printRange(s, Q, width > powerDigits[k] ? width - powerDigits[k] : 0, powers, powerDigits);
+    printRange(s, R, powerDigits[k], powers, powerDigits);
+}
+
+std::ostream& operator<<(std::ostream& s, const BigInteger& number) {
+    //write BigInteger
+    if (number.size == 0) { //number is zero
+        s << "0";
+        return s;
+    }
+    if (number.sign)
+        s << "-";
+    std::vector<BigInteger> powers;
+    std::vector<long> powerDigits;
+    printRange(s, abs(number), 0, powers, powerDigits);
     return s;
 }
 
@@ -105,6 +148,13 @@ void BigInteger::constructFromString(const char* s1) {
         size = 0;
         return;
     }
+    if ((long)strlen(s1) > DecimalSplitMin) {
+        bool negative = sign;
+        std::vector<BigInteger> powers;
+        *this = decimalRange(s1, strlen(s1), powers);
+        sign = negative;
+        return;
+    }
     size = strlen(s1) / Base3Log + (strlen(s1)%Base3Log == 0 ? 0 : 1);
     long size2 = size + size/2 + 1;
     uLong* num1 = new uLong[size];
@@ -128,6 +178,25 @@ void BigInteger::constructFromString(const char* s1) {
     this->deleteLeadingZeroes();
 }
 
+BigInteger decimalRange(const char* s1, long length, std::vector<BigInteger>& powers) {
+    //value of digits s1[0..length), upper part * 10^(DecimalSplitMin*2^k) + lower part, powers are cached
+    if (length <= BigInteger::DecimalSplitMin)
+        return BigInteger(std::string(s1, length));
+    if (powers.empty())
+        powers.push_back(BigInteger(std::string("1") + std::string(BigInteger::DecimalSplitMin - 1, '0'))*10);
+    long lowLength = BigInteger::DecimalSplitMin;
+    size_t k = 0;
+    while (lowLength*2 < length) {
+        lowLength *= 2;
+        k++;
+    }
+    while (powers.size() <= k)
+        powers.push_back(powers.back()*powers.back());
+    BigInteger result = decimalRange(s1, length - lowLength, powers)*powers[k];
+    result += decimalRange(s1 + length - lowLength, lowLength, powers);
+    return result;
+}
+
 BigInteger::BigInteger(std::string s1) {
     this->constructFromString(s1.c_str());
 }
@@ -673,7 +742,7 @@ void KaratsubaMul(const BigInteger &A, const BigInteger &B, BigInteger &C) {//A.
 }
 
 void BigInteger::deleteLeadingZeroes() {
-    while(this->num[size - 1] == 0 && size >= 1) {///not sure but may be true
+    while(size >= 1 && this->num[size - 1] == 0) {
         size--;
         num.pop_back();
     }
@@ -699,7 +768,7 @@ void BigInteger::fromDecimal(uLong* &A, long &size, digit &R) {//digit *a = A.nu
         R = temp & BigInteger::BaseMod;
     }
     long i = 0;
-    while (A[i] == 0 && size > 0) {
+    while (size > 0 && A[i] == 0) {
         i++;
         size--;
     }
@@ -727,6 +796,142 @@ BigInteger lcm(const BigInteger &a, const BigInteger &b) {
     return abs(a*b)/gcd(a, b);
 }
 
+uLong leadingBits(const BigInteger &n, long shift) {
+    //floor(|n| / 2^shift), it has to fit into 64 bits
+    uLong res = 0;
+    for (long j = n.size - 1; j >= 0 && (j + 1)*BigInteger::BaseLog > shift; j--) {
+        long low = j*BigInteger::BaseLog;
+        if (low < shift)
+            res = (res << (low + BigInteger::BaseLog - shift)) | (n.num[j] >> (shift - low));
+        else
+            res = (res << BigInteger::BaseLog) | n.num[j];
+    }
+    return res;
+}
+
+static BigInteger smallMulOrZero(const BigInteger &n, digit c) {
+    //tinyMul by zero would keep the zero digits
+    return c ? tinyMul1(n, c) : BigInteger(0);
+}
+
+BigInteger extGcd(const BigInteger &a, const BigInteger &m, BigInteger &x) {
+    //Lehmer's extended gcd (Knuth, TAOCP Vol. 2, 4.5.2, Algorithm L), returns gcd(a, m) and x from [0, m)
+    //such that a*x = gcd(a, m) (mod m); Euclid's steps are simulated on the leading 62 bits as long as both
+    //bounds give the same quotient, the matrix of one digit cofactors is then applied to the whole numbers
+    if (m <= 0)
+        throw BigIntegerException("Modulus has to be positive", __FILE__, __LINE__);
+    if (a < 0)
+        throw BigIntegerException("Negative number", __FILE__, __LINE__);
+    const long long maxCofactor = BigInteger::BaseMod;
+    BigInteger r0(m), r1(a >= m ? a % m : a), s0(0), s1(1);
+    bool negative = true; //sign of s0, s1 has always the opposite one
+    while (r1 != 0) {
+        long length = r0.bitLength(), shift = length > 62 ? length - 62 : 0;
+        long long x0 = (long long)leadingBits(r0, shift), y0 = (long long)leadingBits(r1, shift);
+        long long A = 1, B = 0, C = 0, D = 1;
+        bool odd = false;
+        while (y0 + C > 0 && y0 + D > 0 && x0 + A >= 0 && x0 + B >= 0) {
+            long long q = (x0 + A)/(y0 + C);
+            if (q != (x0 + B)/(y0 + D) || q > maxCofactor)
+                break;
+            if (llabs(A) + q*llabs(C) > maxCofactor || llabs(B) + q*llabs(D) > maxCofactor) //|A - q*C| = |A| + q*|C|
+                break;
+            long long t = A - q*C;
+            A = C; C = t;
+            t = B - q*D;
+            B = D; D = t;
+            t = x0 - q*y0;
+            x0 = y0; y0 = t;
+            odd = !odd;
+        }
+        if (B == 0) { //no step could be simulated, one full step
+            BigInteger q(r0/r1), r(r0%r1), s(q*s1 + s0);
+            r0 = r1; r1 = r;
+            s0 = s1; s1 = s;
+            negative = !negative;
+            continue;
+        }
+        digit a0 = (digit)llabs(A), b0 = (digit)llabs(B), c0 = (digit)llabs(C), d0 = (digit)llabs(D);
+        BigInteger n0(0), n1(0);
+        if (!odd) { //A >= 0, B <= 0, C <= 0, D >= 0, signs are opposite after an odd number of steps
+            n0 = smallMulOrZero(r0, a0) - smallMulOrZero(r1, b0);
+            n1 = smallMulOrZero(r1, d0) - smallMulOrZero(r0, c0);
+        } else {
+            n0 = smallMulOrZero(r1, b0) - smallMulOrZero(r0, a0);
+            n1 = smallMulOrZero(r0, c0) - smallMulOrZero(r1, d0);
+        }
+        r0 = n0; r1 = n1;
+        n0 = smallMulOrZero(s0, a0) + smallMulOrZero(s1, b0);
+        n1 = smallMulOrZero(s0, c0) + smallMulOrZero(s1, d0);
+        s0 = n0; s1 = n1;
+        negative ^= odd;
+    }
+    if (s0 >= m)
+        s0 = s0 % m;
+    x = negative && s0 != 0 ? m - s0 : s0;
+    return r0;
+}
+
+BigInteger modInverse(const BigInteger &a, const BigInteger &m) {
+    //modular inverse by the Lehmer's extended gcd
+    BigInteger x(0);
+    if (extGcd(a, m, x) != 1)
+        throw BigIntegerException("Number is not invertible", __FILE__, __LINE__);
+    return x;
+}
+
+BigInteger binaryModInverse(const BigInteger &a, const BigInteger &m) {
+    //modular inverse by the binary extended gcd (shifts and subtractions only), even m is handled through
+    //the inverse y of m modulo odd a: a*(1 + m*(a - y))/a = 1 (mod m)
+    if (m <= 0)
+        throw BigIntegerException("Modulus has to be positive", __FILE__, __LINE__);
+    if (a < 0)
+        throw BigIntegerException("Negative number", __FILE__, __LINE__);
+    BigInteger u(a >= m ? a % m : a);
+    if (m == 1)
+        return 0;
+    if (u == 0 || (m.num[0] % 2 == 0 && u.num[0] % 2 == 0))
+        throw BigIntegerException("Number is not invertible", __FILE__, __LINE__);
+    if (u == 1)
+        return 1;
+    if (m.num[0] % 2 == 0) {
+        BigInteger y(binaryModInverse(m % u, u));
+        return (m*(u - y) + 1)/u;
+    }
+    digit mInverse = m.num[0]; //m^(-1) mod 2^BaseLog by Newton's iteration
+    for (int i = 0; i < 5; i++)
+        mInverse *= 2 - m.num[0]*mInverse;
+    const digit maxShift = BigInteger::BaseLog - 1;
+    BigInteger v(m), x1(1), x2(0); //u = x1*a (mod m), v = x2*a (mod m)
+    auto halve = [&m, mInverse, maxShift](BigInteger &u, BigInteger &x) {
+        //u /= 2^zeros, x = x/2^zeros (mod m), t = -x/m mod 2^zeros makes the lowest bits of x + t*m zero
+        while (u.num[0] % 2 == 0) {
+            digit zeros = 0, r;
+            while (zeros < maxShift && (u.num[0] >> zeros) % 2 == 0)
+                zeros++;
+            tinyDivide(u, u, 1U << zeros, r);
+            digit t = (x.size ? 0U - x.num[0]*mInverse : 0U) & ((1U << zeros) - 1);
+            if (t)
+                x = x + tinyMul1(m, t);
+            tinyDivide(x, x, 1U << zeros, r);
+        }
+    };
+    while (u != 1 && v != 1) {
+        halve(u, x1);
+        halve(v, x2);
+        if (u >= v) {
+            u = u - v;
+            x1 = x1 < x2 ? x1 + m - x2 : x1 - x2;
+        } else {
+            v = v - u;
+            x2 = x2 < x1 ? x2 + m - x1 : x2 - x1;
+        }
+        if (u == 0 || v == 0) //the other one is gcd(a, m) > 1
+            throw BigIntegerException("Number is not invertible", __FILE__, __LINE__);
+    }
+    return u == 1 ? x1 : x2;
+}
+
 BigInteger fib(const BigInteger &n) {
     //n-th Fibonacci number
     if (n.sign)
@@ -754,6 +959,35 @@ BigInteger fact(const BigInteger&n) {
     return result;
 }
 
+long BigInteger::bitLength() const {
+    if (size == 0)
+        return 0;
+    long bits = (size - 1) * BigInteger::BaseLog;
+    for (digit top = num[size - 1]; top != 0; top >>= 1)
+        bits++;
+    return bits;
+}
+
+BigInteger BigInteger::fromLimbs(const std::vector<digit> &limbs) {
+    BigInteger result;
+    if (limbs.empty())
+        return result;
+    //bits above BaseLog are dropped
+    result.num.resize(limbs.size());
+    for (size_t i = 0; i < limbs.size(); i++)
+        result.num[i] = limbs[i] & BigInteger::BaseMod;
+    result.size = limbs.size();
+    result.sign = false;
+    result.deleteLeadingZeroes();
+    if (result.num.empty())
+        result.num.push_back(0);
+    return result;
+}
+
+std::vector<digit> BigInteger::toLimbs() const {
+    return std::vector<digit>(num.begin(), num.begin() + size);
+}
+
 unsigned int BigInteger::toUint() const {
     if (size == 0 || size > 2)//ignore these numbers - they are too big
         return 0;
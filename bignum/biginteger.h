@@ -49,6 +49,11 @@ public:
 #endif
 
     long getSize() const {return size;};
+    bool isNegative() const {return sign && size != 0;};
+    long bitLength() const;
+    static int limbBits() {return BaseLog;};
+    static BigInteger fromLimbs(const std::vector<digit>&); //non-negative, limbs of limbBits() bits, least significant first
+    std::vector<digit> toLimbs() const; //absolute value, limbs of limbBits() bits, least significant first
 
     BigInteger& operator=(const BigInteger&);
 
@@ -87,6 +92,9 @@ public:
     friend BigInteger pow(BigInteger, BigInteger);
     friend BigInteger gcd(const BigInteger&, const BigInteger&);
     friend BigInteger lcm(const BigInteger&, const BigInteger&);
+    friend BigInteger extGcd(const BigInteger&, const BigInteger&, BigInteger&);
+    friend BigInteger modInverse(const BigInteger&, const BigInteger&);
+    friend BigInteger binaryModInverse(const BigInteger&, const BigInteger&);
     friend BigInteger fib(const BigInteger&);
     friend BigInteger fact(const BigInteger&);
     friend BigInteger abs(const BigInteger&);
@@ -110,6 +118,8 @@ private:
     static const digit Base2Log = 4, Base3Log = Base2Log + 1;
 #endif
     static const long KaratsubaMin = 80;
+    static const long DecimalSplitMin = 1000; //decimal digits parsed without splitting
+    static const long PrintSplitMin = 60; //digits printed without splitting
     static const uLong Base3 = (uLong)Base2*10;
 
     friend bool absCompare(const BigInteger&, const BigInteger&);
@@ -122,6 +132,10 @@ private:
     friend void bigSub(const BigInteger&, const BigInteger&, BigInteger&);
     friend BigInteger smallMul(const BigInteger&, const BigInteger&);
     friend BigInteger largeMul(const BigInteger&, const BigInteger&);
+    friend BigInteger decimalRange(const char*, long, std::vector<BigInteger>&);
+    friend void printRange(std::ostream&, const BigInteger&, long, std::vector<BigInteger>&, std::vector<long>&);
+    friend void printSmall(std::ostream&, const BigInteger&, long);
+    friend uLong leadingBits(const BigInteger&, long);
 
     void constructFromString(const char*);
     template<class T>
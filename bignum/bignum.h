@@ -0,0 +1,297 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * Backend of the common bignum API, specialized for every big integer type (bignum_biginteger.h, bignum_mpint.h)
+ * A specialization provides these static functions (the API below checks the arguments before calling them):
+ * - Num fromBytes(const std::vector<uint8_t> &bytes) - non-negative number from big-endian bytes
+ * - std::vector<uint8_t> toBytes(const Num &num) - big-endian bytes of the absolute value without leading zeros
+ * - bool isZero(const Num &num), bool isNegative(const Num &num), Num negate(const Num &num)
+ * - Num mulMod(const Num &a, const Num &b, const Num &modulus) - result in [0, modulus)
+ * - Num powMod(const Num &base, const Num &exponent, const Num &modulus) - exponent >= 0, result in [0, modulus)
+ * - Num inverse(const Num &a, const Num &modulus) - non-negative a, throws std::invalid_argument if gcd(a, m) != 1
+ * - std::string toDecimal(const Num &num), Num fromDecimal(const std::string &digits) - signed decimal strings
+ * @tparam Num Big integer type
+ */
+template<typename Num>
+struct BignumBackend;
+
+/** Smallest radix of the radix conversions */
+constexpr int MIN_RADIX = 2;
+/** Largest radix of the radix conversions (digits 0 - 9 and letters a - z) */
+constexpr int MAX_RADIX = 36;
+
+/**
+ * Creates a non-negative number from its big-endian bytes
+ * @tparam Num Big integer type
+ * @param bytes Bytes (the most significant one first)
+ * @return Number
+ */
+template<typename Num>
+Num from_bytes(const std::vector<uint8_t> &bytes) {
+    return BignumBackend<Num>::fromBytes(bytes);
+}
+
+/**
+ * Returns the big-endian bytes of the absolute value of a number (without leading zeros, zero has no bytes)
+ * @tparam Num Big integer type
+ * @param num Number
+ * @return Bytes (the most significant one first)
+ */
+template<typename Num>
+std::vector<uint8_t> to_bytes(const Num &num) {
+    return BignumBackend<Num>::toBytes(num);
+}
+
+/**
+ * Checks that the modulus is positive
+ * @tparam Num Big integer type
+ * @param modulus Modulus
+ */
+template<typename Num>
+void check_modulus(const Num &modulus) {
+    if (BignumBackend<Num>::isNegative(modulus) || BignumBackend<Num>::isZero(modulus))
+        throw std::invalid_argument("Modulus has to be positive");
+}
+
+/**
+ * Multiplies two numbers modulo the modulus
+ * @tparam Num Big integer type
+ * @param a Number (can be negative)
+ * @param b Number (can be negative)
+ * @param modulus Modulus (positive)
+ * @return a * b mod modulus in the range [0, modulus)
+ */
+template<typename Num>
+Num mod_mul(const Num &a, const Num &b, const Num &modulus) {
+    check_modulus(modulus);
+    return BignumBackend<Num>::mulMod(a, b, modulus);
+}
+
+/**
+ * Modular exponentiation
+ * @tparam Num Big integer type
+ * @param base Base (can be negative)
+ * @param exponent Exponent (non-negative)
+ * @param modulus Modulus (positive)
+ * @return base^exponent mod modulus in the range [0, modulus)
+ */
+template<typename Num>
+Num mod_pow(const Num &base, const Num &exponent, const Num &modulus) {
+    check_modulus(modulus);
+    if (BignumBackend<Num>::isNegative(exponent))
+        throw std::invalid_argument("Exponent has to be non-negative");
+    return BignumBackend<Num>::powMod(base, exponent, modulus);
+}
+
+/**
+ * Modular inverse
+ * If the inverse doesn't exist (gcd(a, modulus) != 1), an invalid argument exception is thrown
+ * @tparam Num Big integer type
+ * @param a Number (non-negative)
+ * @param modulus Modulus (positive)
+ * @return x from [0, modulus) such that a * x = 1 (mod modulus)
+ */
+template<typename Num>
+Num mod_inverse(const Num &a, const Num &modulus) {
+    check_modulus(modulus);
+    if (BignumBackend<Num>::isNegative(a))
+        throw std::invalid_argument("Only non-negative numbers can be inverted");
+    return BignumBackend<Num>::inverse(a, modulus);
+}
+
+/**
+ * Returns the value of a digit character
+ * @param c Character (0 - 9, a - z or A - Z)
+ * @param radix Radix of the number
+ * @return Value of the digit
+ */
+inline uint32_t digit_value(char c, int radix) {
+    int value = MAX_RADIX;
+    if (c >= '0' && c <= '9')
+        value = c - '0';
+    else if (c >= 'a' && c <= 'z')
+        value = c - 'a' + 10;
+    else if (c >= 'A' && c <= 'Z')
+        value = c - 'A' + 10;
+    if (value >= radix)
+        throw std::invalid_argument(std::string("Invalid digit ") + c + " of radix " + std::to_string(radix));
+    return static_cast<uint32_t>(value);
+}
+
+/**
+ * Returns the number of bits of a digit if the radix is a power of two
+ * @param radix Radix
+ * @return log2(radix), 0 if the radix isn't a power of two
+ */
+inline int radix_bits(int radix) {
+    if (radix & (radix - 1))
+        return 0;
+    int bits = 0;
+    while ((1 << bits) < radix)
+        bits++;
+    return bits;
+}
+
+/**
+ * Returns the largest power of the radix (and its exponent) which fits into 32 bits
+ * @param radix Radix
+ * @return Power of the radix and the number of digits it covers
+ */
+inline std::pair<uint32_t, int> radix_chunk(int radix) {
+    uint64_t power = radix;
+    int digits = 1;
+    while (power * radix <= UINT32_MAX) {
+        power *= radix;
+        digits++;
+    }
+    return {static_cast<uint32_t>(power), digits};
+}
+
+/**
+ * Converts big-endian bytes to the digits of a radix
+ * Powers of two take the bits directly, other radices divide the number (base 2^32 words) by the largest power of
+ * the radix fitting into a word, so one division gives several digits
+ * @param bytes Bytes (the most significant one first, no leading zeros)
+ * @param radix Radix (not 10, the backends have their own decimal conversion)
+ * @return Digits (the most significant one first)
+ */
+inline std::string bytes_to_radix(const std::vector<uint8_t> &bytes, int radix) {
+    constexpr char DIGITS[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+    if (bytes.empty())
+        return "0";
+
+    std::string res;
+    if (int bits = radix_bits(radix)) {
+        const uint64_t total_bits = bytes.size() * 8;
+        for (uint64_t position = 0; position < total_bits; position += bits) {
+            uint32_t digit = 0;
+            for (int bit = 0; bit < bits && position + bit < total_bits; bit++) {
+                uint64_t index = position + bit;
+                digit |= ((bytes[bytes.size() - 1 - index / 8] >> (index % 8)) & 1) << bit;
+            }
+            res.push_back(DIGITS[digit]);
+        }
+    } else {
+        std::vector<uint32_t> words((bytes.size() + 3) / 4, 0);
+        for (size_t i = 0; i < bytes.size(); i++)
+            words[i / 4] |= static_cast<uint32_t>(bytes[bytes.size() - 1 - i]) << (8 * (i % 4));
+        const auto [chunk, chunk_digits] = radix_chunk(radix);
+        while (!words.empty()) {
+            uint64_t remainder = 0;
+            for (auto i = static_cast<int64_t>(words.size()) - 1; i >= 0; i--) {
+                uint64_t current = (remainder << 32) | words[i];
+                words[i] = static_cast<uint32_t>(current / chunk);
+                remainder = current % chunk;
+            }
+            while (!words.empty() && words.back() == 0)
+                words.pop_back();
+            // Every chunk except the most significant one has all its digits (including the leading zeros)
+            for (int i = 0; i < chunk_digits && (!words.empty() || remainder); i++) {
+                res.push_back(DIGITS[remainder % radix]);
+                remainder /= radix;
+            }
+        }
+    }
+    while (res.size() > 1 && res.back() == '0')
+        res.pop_back();
+    std::reverse(res.begin(), res.end());
+    return res;
+}
+
+/**
+ * Converts the digits of a radix to big-endian bytes (inverse of bytes_to_radix())
+ * @param digits Digits (the most significant one first, without a sign)
+ * @param radix Radix (not 10)
+ * @return Bytes (the most significant one first, no leading zeros)
+ */
+inline std::vector<uint8_t> radix_to_bytes(const std::string &digits, int radix) {
+    std::vector<uint32_t> words;
+    if (int bits = radix_bits(radix)) {
+        uint64_t position = 0;
+        for (auto it = digits.rbegin(); it != digits.rend(); ++it, position += bits) {
+            uint64_t value = digit_value(*it, radix);
+            if (words.size() <= (position + bits) / 32)
+                words.resize((position + bits) / 32 + 1, 0);
+            words[position / 32] |= static_cast<uint32_t>(value << (position % 32));
+            if (position % 32 + bits > 32)
+                words[position / 32 + 1] |= static_cast<uint32_t>(value >> (32 - position % 32));
+        }
+    } else {
+        // Horner's scheme with several digits at once: words = words * radix^k + chunk
+        const auto [chunk, chunk_digits] = radix_chunk(radix);
+        for (size_t start = 0; start < digits.size(); start += chunk_digits) {
+            const size_t end = std::min(digits.size(), start + chunk_digits);
+            uint64_t multiplier = 1, carry = 0;
+            for (size_t i = start; i < end; i++) {
+                multiplier *= radix;
+                carry = carry * radix + digit_value(digits[i], radix);
+            }
+            for (auto &word : words) {
+                uint64_t current = word * multiplier + carry;
+                word = static_cast<uint32_t>(current);
+                carry = current >> 32;
+            }
+            if (carry)
+                words.push_back(static_cast<uint32_t>(carry));
+        }
+    }
+
+    std::vector<uint8_t> res;
+    res.reserve(words.size() * 4);
+    for (auto it = words.rbegin(); it != words.rend(); ++it)
+        for (int shift = 24; shift >= 0; shift -= 8)
+            res.push_back(static_cast<uint8_t>(*it >> shift));
+    res.erase(res.begin(), std::find_if(res.begin(), res.end(), [](uint8_t byte) { return byte != 0; }));
+    return res;
+}
+
+/**
+ * Returns the string representation of a number in a radix (lowercase letters for the digits above 9)
+ * @tparam Num Big integer type
+ * @param num Number (can be negative)
+ * @param radix Radix (2 - 36)
+ * @return Digits of the number, the most significant one first ('-' for negative numbers)
+ */
+template<typename Num>
+std::string to_radix_string(const Num &num, int radix) {
+    if (radix < MIN_RADIX || radix > MAX_RADIX)
+        throw std::invalid_argument("Radix has to be between 2 and 36");
+    if (radix == 10)
+        return BignumBackend<Num>::toDecimal(num);
+    auto digits = bytes_to_radix(to_bytes(num), radix);
+    return BignumBackend<Num>::isNegative(num) ? "-" + digits : digits;
+}
+
+/**
+ * Parses a number in a radix (inverse of to_radix_string(), letters of both cases are accepted)
+ * @tparam Num Big integer type
+ * @param text Digits of the number, the most significant one first (can start with '-')
+ * @param radix Radix (2 - 36)
+ * @return Number
+ */
+template<typename Num>
+Num from_radix_string(const std::string &text, int radix) {
+    if (radix < MIN_RADIX || radix > MAX_RADIX)
+        throw std::invalid_argument("Radix has to be between 2 and 36");
+    const bool negative = !text.empty() && text[0] == '-';
+    const std::string digits = negative ? text.substr(1) : text;
+    if (digits.empty())
+        throw std::invalid_argument("Number has no digits");
+
+    Num res;
+    if (radix == 10) {
+        for (char c : digits)
+            digit_value(c, radix);
+        res = BignumBackend<Num>::fromDecimal(digits);
+    } else {
+        res = from_bytes<Num>(radix_to_bytes(digits, radix));
+    }
+    return negative ? BignumBackend<Num>::negate(res) : res;
+}
@@ -0,0 +1,215 @@
+#include <sstream>
+#include "bignum_biginteger.h"
+
+/** Smallest exponent (in bits) powMod() uses the window for, shorter exponents use the binary method */
+constexpr long WINDOW_THRESHOLD = 64;
+
+/**
+ * Creates a non-negative number from big-endian bytes (repacked to the limbs of BigInteger)
+ * @param bytes Bytes (the most significant one first)
+ * @return Number
+ */
+BigInteger BignumBackend<BigInteger>::fromBytes(const std::vector<uint8_t> &bytes) {
+    const int limb_bits = BigInteger::limbBits();
+    std::vector<digit> limbs;
+    limbs.reserve(bytes.size() * 8 / limb_bits + 1);
+    uint64_t buffer = 0;
+    int buffered = 0;
+    for (auto it = bytes.rbegin(); it != bytes.rend(); ++it) {
+        buffer |= static_cast<uint64_t>(*it) << buffered;
+        buffered += 8;
+        if (buffered >= limb_bits) {
+            limbs.push_back(static_cast<digit>(buffer & ((uint64_t{1} << limb_bits) - 1)));
+            buffer >>= limb_bits;
+            buffered -= limb_bits;
+        }
+    }
+    if (buffered)
+        limbs.push_back(static_cast<digit>(buffer));
+    return BigInteger::fromLimbs(limbs);
+}
+
+/**
+ * Returns the big-endian bytes of the absolute value of a number
+ * @param num Number
+ * @return Bytes (the most significant one first, no leading zeros)
+ */
+std::vector<uint8_t> BignumBackend<BigInteger>::toBytes(const BigInteger &num) {
+    const int limb_bits = BigInteger::limbBits();
+    std::vector<uint8_t> res;
+    res.reserve(num.getSize() * limb_bits / 8 + 1);
+    uint64_t buffer = 0;
+    int buffered = 0;
+    for (auto limb : num.toLimbs()) {
+        buffer |= static_cast<uint64_t>(limb) << buffered;
+        buffered += limb_bits;
+        for (; buffered >= 8; buffered -= 8, buffer >>= 8)
+            res.push_back(static_cast<uint8_t>(buffer));
+    }
+    if (buffered)
+        res.push_back(static_cast<uint8_t>(buffer));
+    while (!res.empty() && res.back() == 0)
+        res.pop_back();
+    std::reverse(res.begin(), res.end());
+    return res;
+}
+
+/**
+ * Tells if the number is zero
+ * @param num Number
+ * @return True for zero
+ */
+bool BignumBackend<BigInteger>::isZero(const BigInteger &num) {
+    return num.getSize() == 0;
+}
+
+/**
+ * Tells if the number is negative
+ * @param num Number
+ * @return True for negative numbers
+ */
+bool BignumBackend<BigInteger>::isNegative(const BigInteger &num) {
+    return num.isNegative();
+}
+
+/**
+ * Returns the opposite number
+ * @param num Number
+ * @return -num
+ */
+BigInteger BignumBackend<BigInteger>::negate(const BigInteger &num) {
+    return isZero(num) ? num : -num;
+}
+
+/**
+ * Multiplies two numbers modulo the modulus
+ * @param a Number
+ * @param b Number
+ * @param modulus Modulus (positive)
+ * @return a * b mod modulus in the range [0, modulus)
+ */
+BigInteger BignumBackend<BigInteger>::mulMod(const BigInteger &a, const BigInteger &b, const BigInteger &modulus) {
+    // Remainder of BigInteger keeps the sign only if the dividend is smaller than the modulus, so the absolute value
+    // is reduced and the sign of the product is applied here
+    BigInteger product = a * b;
+    if (!product.isNegative())
+        return product % modulus;
+    BigInteger res = abs(product) % modulus;
+    return isZero(res) ? res : modulus - res;
+}
+
+/**
+ * Modular exponentiation by the left-to-right method with a fixed window of WINDOW_BITS bits
+ * (base^0 - base^(2^WINDOW_BITS - 1) are precomputed, every window costs WINDOW_BITS squarings and one multiplication)
+ * @param base Base
+ * @param exponent Exponent (non-negative)
+ * @param modulus Modulus (positive)
+ * @return base^exponent mod modulus in the range [0, modulus)
+ */
+BigInteger BignumBackend<BigInteger>::powMod(const BigInteger &base, const BigInteger &exponent,
+                                             const BigInteger &modulus) {
+    const BigInteger one = BigInteger(1) % modulus;
+    const long bits = exponent.bitLength();
+    if (bits == 0)
+        return one;
+    const int window_bits = bits >= WINDOW_THRESHOLD ? WINDOW_BITS : 1;
+    const int limb_bits = BigInteger::limbBits();
+    const std::vector<digit> limbs = exponent.toLimbs();
+
+    std::vector<BigInteger> powers(size_t{1} << window_bits);
+    powers[0] = one;
+    powers[1] = mulMod(base, one, modulus);
+    for (size_t i = 2; i < powers.size(); i++)
+        powers[i] = mulMod(powers[i - 1], powers[1], modulus);
+
+    BigInteger res = one;
+    for (long window = (bits - 1) / window_bits; window >= 0; window--) {
+        unsigned value = 0;
+        for (int bit = window_bits - 1; bit >= 0; bit--) {
+            long index = window * window_bits + bit;
+            value = value << 1 | (index < bits ? (limbs[index / limb_bits] >> (index % limb_bits)) & 1 : 0);
+        }
+        if (window != (bits - 1) / window_bits) {
+            for (int i = 0; i < window_bits; i++)
+                res = res * res % modulus;
+            if (value)
+                res = res * powers[value] % modulus;
+        } else {
+            res = powers[value];
+        }
+    }
+    return res;
+}
+
+/**
+ * Modular inverse by the Lehmer's extended gcd (extGcd() in biginteger.cpp)
+ * @param a Number (non-negative)
+ * @param modulus Modulus (positive)
+ * @return x from [0, modulus) such that a * x = 1 (mod modulus)
+ */
+BigInteger BignumBackend<BigInteger>::inverse(const BigInteger &a, const BigInteger &modulus) {
+    BigInteger x(0);
+    if (extGcd(a, modulus, x) != 1)
+        throw std::invalid_argument("Number is not invertible modulo the modulus");
+    return x;
+}
+
+/**
+ * Returns the decimal string of a number (divide and conquer printing of BigInteger)
+ * @param num Number
+ * @return Decimal digits ('-' for negative numbers)
+ */
+std::string BignumBackend<BigInteger>::toDecimal(const BigInteger &num) {
+    std::ostringstream stream;
+    stream << num;
+    return stream.str();
+}
+
+/**
+ * Parses a decimal string (divide and conquer parsing of BigInteger)
+ * @param digits Decimal digits (can start with '-')
+ * @return Number
+ */
+BigInteger BignumBackend<BigInteger>::fromDecimal(const std::string &digits) {
+    return BigInteger(digits);
+}
+
+/**
+ * Generates a uniform random non-negative number with the given number of bits (limbs are filled directly)
+ * @param bits Number of random bits (the number is smaller than 2^bits)
+ * @param rng Random generator
+ * @return Random number
+ */
+BigInteger random_bits(long bits, ChaCha20Rng &rng) {
+    if (bits <= 0)
+        return BigInteger();
+
+    const long limb_bits = BigInteger::limbBits();
+    std::vector<digit> limbs((bits + limb_bits - 1) / limb_bits);
+    rng.fill(limbs.data(), limbs.size());
+    // Every limb keeps its lower limb_bits bits, the top limb only the remaining bits
+    for (auto &limb : limbs)
+        limb &= (digit{1} << limb_bits) - 1;
+    if (bits % limb_bits)
+        limbs.back() &= (digit{1} << (bits % limb_bits)) - 1;
+    return BigInteger::fromLimbs(limbs);
+}
+
+/**
+ * Generates a uniform random number from the range [0, bound)
+ * Numbers with the bit length of the bound are drawn until one is smaller than the bound (at most 2 draws
+ * on average)
+ * @param bound Upper bound (exclusive, positive)
+ * @param rng Random generator
+ * @return Random number smaller than the bound
+ */
+BigInteger random_below(const BigInteger &bound, ChaCha20Rng &rng) {
+    if (bound <= 0)
+        throw std::invalid_argument("Upper bound of the random number has to be positive");
+
+    const long bits = bound.bitLength();
+    BigInteger res = random_bits(bits, rng);
+    while (res >= bound)
+        res = random_bits(bits, rng);
+    return res;
+}
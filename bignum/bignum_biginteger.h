@@ -0,0 +1,30 @@
+#pragma once
+
+#include "bignum.h"
+#include "csprng.h"
+#include "biginteger.h"
+
+/**
+ * BigInteger backend of the common bignum API (compiled in bignum_biginteger.cpp, works from C++17)
+ * Modular exponentiation reads the bits of the exponent from its limbs and uses a fixed window, the reductions are
+ * the long divisions of BigInteger
+ */
+template<>
+struct BignumBackend<BigInteger> {
+    /** Number of bits of the exponent processed by one multiplication of powMod() */
+    static constexpr int WINDOW_BITS = 4;
+
+    static BigInteger fromBytes(const std::vector<uint8_t> &bytes);
+    static std::vector<uint8_t> toBytes(const BigInteger &num);
+    static bool isZero(const BigInteger &num);
+    static bool isNegative(const BigInteger &num);
+    static BigInteger negate(const BigInteger &num);
+    static BigInteger mulMod(const BigInteger &a, const BigInteger &b, const BigInteger &modulus);
+    static BigInteger powMod(const BigInteger &base, const BigInteger &exponent, const BigInteger &modulus);
+    static BigInteger inverse(const BigInteger &a, const BigInteger &modulus);
+    static std::string toDecimal(const BigInteger &num);
+    static BigInteger fromDecimal(const std::string &digits);
+};
+
+BigInteger random_bits(long bits, ChaCha20Rng &rng = thread_rng());
+BigInteger random_below(const BigInteger &bound, ChaCha20Rng &rng = thread_rng());
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <type_traits>
+#include "bignum.h"
+#include "csprng.h"
+#include "my_big_int.h"
+
+/**
+ * MPInt backend of the common bignum API (header only, needs C++23 like MPInt itself)
+ * Modular exponentiation reduces by the Barrett's ModContext and uses a fixed window, the inverse is the Lehmer's
+ * extended gcd (mod_inverse() in my_big_int.h)
+ * @tparam max_digits Maximum number of digits of the numbers
+ * @tparam Limbs Base of the digits of the numbers
+ */
+template<ValidDigit T, T max_digits, LimbBackend Limbs>
+struct BignumBackend<MPInt<T, max_digits, Limbs>> {
+    /** Big integer of the backend */
+    using Num = MPInt<T, max_digits, Limbs>;
+    /** Number of bits of the exponent processed by one multiplication of powMod() */
+    static constexpr int WINDOW_BITS = 4;
+    /** Smallest exponent (in bits) powMod() uses the window for, shorter exponents use the binary method */
+    static constexpr uint64_t WINDOW_THRESHOLD = 64;
+
+    /**
+     * Creates a non-negative number from big-endian bytes
+     * @param bytes Bytes (the most significant one first)
+     * @return Number
+     */
+    static Num fromBytes(const std::vector<uint8_t> &bytes) {
+        std::vector<uint32_t> words((bytes.size() + 3) / 4, 0);
+        for (size_t i = 0; i < bytes.size(); i++)
+            words[i / 4] |= static_cast<uint32_t>(bytes[bytes.size() - 1 - i]) << (8 * (i % 4));
+        while (!words.empty() && words.back() == 0)
+            words.pop_back();
+        if (words.empty())
+            words.push_back(0);
+        return from_binary_digits<T, max_digits, Limbs>(words);
+    }
+
+    /**
+     * Returns the big-endian bytes of the absolute value of a number
+     * @param num Number
+     * @return Bytes (the most significant one first, no leading zeros)
+     */
+    static std::vector<uint8_t> toBytes(const Num &num) {
+        auto words = binary_digits(num);
+        std::vector<uint8_t> res;
+        res.reserve(words.size() * 4);
+        for (auto it = words.rbegin(); it != words.rend(); ++it)
+            for (int shift = 24; shift >= 0; shift -= 8)
+                if (!res.empty() || (*it >> shift) & 0xff)
+                    res.push_back(static_cast<uint8_t>(*it >> shift));
+        return res;
+    }
+
+    /**
+     * Tells if the number is zero
+     * @param num Number
+     * @return True for zero
+     */
+    static bool isZero(const Num &num) {
+        return num.isZero();
+    }
+
+    /**
+     * Tells if the number is negative
+     * @param num Number
+     * @return True for negative numbers
+     */
+    static bool isNegative(const Num &num) {
+        return num.getSign() < 0 && !num.isZero();
+    }
+
+    /**
+     * Returns the opposite number
+     * @param num Number
+     * @return -num
+     */
+    static Num negate(const Num &num) {
+        return num.isZero() ? num : Num(num.getNumber(), -num.getSign());
+    }
+
+    /**
+     * Multiplies two numbers modulo the modulus
+     * One product doesn't pay off the Barrett reciprocal, the remainder is a plain division
+     * @param a Number
+     * @param b Number
+     * @param modulus Modulus (positive)
+     * @return a * b mod modulus in the range [0, modulus)
+     */
+    static Num mulMod(const Num &a, const Num &b, const Num &modulus) {
+        // The remainder has the sign of the product
+        Num res = a * b % modulus;
+        return isNegative(res) ? res + modulus : res;
+    }
+
+    /**
+     * Modular exponentiation by the left-to-right method with a fixed window of WINDOW_BITS bits
+     * (base^0 - base^(2^WINDOW_BITS - 1) are precomputed, every window costs WINDOW_BITS squarings and one
+     * multiplication), all the products are reduced by one ModContext
+     * @param base Base
+     * @param exponent Exponent (non-negative)
+     * @param modulus Modulus (positive)
+     * @return base^exponent mod modulus in the range [0, modulus)
+     */
+    static Num powMod(const Num &base, const Num &exponent, const Num &modulus) {
+        const ModContext<T, max_digits, Limbs> context(modulus);
+        const Num one = context.reduce(Num(1));
+        const uint64_t bits = exponent.bitLength();
+        if (bits == 0)
+            return one;
+        const int window_bits = bits >= WINDOW_THRESHOLD ? WINDOW_BITS : 1;
+        const auto words = binary_digits(exponent);
+
+        std::vector<Num> powers(size_t{1} << window_bits);
+        powers[0] = one;
+        powers[1] = context.reduce(base);
+        for (size_t i = 2; i < powers.size(); i++)
+            powers[i] = context.mulmod(powers[i - 1], powers[1]);
+
+        const uint64_t top_window = (bits - 1) / window_bits;
+        Num res = one;
+        for (auto window = static_cast<int64_t>(top_window); window >= 0; window--) {
+            unsigned value = 0;
+            for (int bit = window_bits - 1; bit >= 0; bit--) {
+                uint64_t index = window * window_bits + bit;
+                value = value << 1 | (index < bits ? (words[index / 32] >> (index % 32)) & 1 : 0);
+            }
+            if (static_cast<uint64_t>(window) != top_window) {
+                for (int i = 0; i < window_bits; i++)
+                    res = context.mulmod(res, res);
+                if (value)
+                    res = context.mulmod(res, powers[value]);
+            } else {
+                res = powers[value];
+            }
+        }
+        return res;
+    }
+
+    /**
+     * Modular inverse by the Lehmer's extended gcd
+     * @param a Number (non-negative)
+     * @param modulus Modulus (positive)
+     * @return x from [0, modulus) such that a * x = 1 (mod modulus)
+     */
+    static Num inverse(const Num &a, const Num &modulus) {
+        return mod_inverse<T, max_digits, Limbs>(a, modulus);
+    }
+
+    /**
+     * Returns the decimal string of a number
+     * @param num Number
+     * @return Decimal digits ('-' for negative numbers)
+     */
+    static std::string toDecimal(const Num &num) {
+        return num.toString();
+    }
+
+    /**
+     * Parses a decimal string
+     * @param digits Decimal digits (can start with '-')
+     * @return Number
+     */
+    static Num fromDecimal(const std::string &digits) {
+        return Num(digits);
+    }
+};
+
+/**
+ * Checks if the type is MPInt with binary limbs (random limbs are then uniform random bits)
+ * @tparam Num Type
+ */
+template<typename Num>
+struct IsBinaryMPInt : std::false_type {
+};
+
+template<ValidDigit T, T max_digits>
+struct IsBinaryMPInt<MPInt<T, max_digits, BinaryLimbs>> : std::true_type {
+};
+
+/**
+ * Generates a uniform random non-negative number with the given number of bits (limbs are filled directly)
+ * @param bits Number of random bits (the number is smaller than 2^bits)
+ * @param rng Random generator
+ * @tparam Num MPInt with binary limbs
+ * @return Random number
+ */
+template<typename Num> requires IsBinaryMPInt<Num>::value
+Num random_bits(uint64_t bits, ChaCha20Rng &rng = thread_rng()) {
+    if (!bits)
+        return Num(0);
+
+    typename Num::Storage digits((bits + 31) / 32, 0);
+    rng.fill(digits.data(), digits.size());
+    // Bits above the requested number are cleared
+    if (bits % 32)
+        digits[digits.size() - 1] &= (uint32_t{1} << (bits % 32)) - 1;
+    size_t size = digits.size();
+    while (size > 1 && !digits[size - 1])
+        size--;
+    digits.resize(size);
+    return {std::move(digits), 1};
+}
+
+/**
+ * Generates a uniform random number from the range [0, bound)
+ * Numbers with the bit length of the bound are drawn until one is smaller than the bound (at most 2 draws
+ * on average)
+ * @param bound Upper bound (exclusive, positive)
+ * @param rng Random generator
+ * @tparam Num MPInt with binary limbs
+ * @return Random number smaller than the bound
+ */
+template<typename Num> requires IsBinaryMPInt<Num>::value
+Num random_below(const Num &bound, ChaCha20Rng &rng = thread_rng()) {
+    if (bound.getSign() < 0 || bound.isZero())
+        throw std::invalid_argument("Upper bound of the random number has to be positive");
+
+    const auto bits = bound.bitLength();
+    Num res = random_bits<Num>(bits, rng);
+    while (res >= bound)
+        res = random_bits<Num>(bits, rng);
+    return res;
+}
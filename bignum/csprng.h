@@ -0,0 +1,262 @@
+#pragma once
+
+#include <array>
+#include <random>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <cstdint>
+
+/** Number of 32-bit words in the state (and in the output block) of ChaCha20 */
+constexpr size_t CHACHA_WORDS = 16;
+/** Number of double rounds of ChaCha20 (20 rounds) */
+constexpr int CHACHA_DOUBLE_ROUNDS = 10;
+/** Constant words of ChaCha20 ("expand 32-byte k") */
+constexpr uint32_t CHACHA_CONSTANTS[4] = {0x61707865, 0x3320646e, 0x79622d32, 0x6b206574};
+
+/**
+ * Cryptographically secure random generator - ChaCha20 keystream (D. J. Bernstein, 64-bit block counter
+ * and 64-bit nonce)
+ * The generator satisfies UniformRandomBitGenerator, so it can be used with the std distributions as well
+ * One instance must not be shared between threads, every thread has its own (see thread_rng())
+ * Random big integers are drawn by random_bits() and random_below() of the backends (bignum_biginteger.h,
+ * bignum_mpint.h)
+ */
+class ChaCha20Rng {
+public:
+    /** Type of the generated values */
+    using result_type = uint32_t;
+
+private:
+    /** Input state (constants, key, block counter and nonce) */
+    std::array<uint32_t, CHACHA_WORDS> mState;
+    /** Current block of the keystream */
+    std::array<uint32_t, CHACHA_WORDS> mBlock;
+    /** Index of the next unused word of the current block */
+    size_t mPosition;
+
+    /**
+     * Rotates a word to the left
+     * @param value Word
+     * @param shift Number of bits (1 - 31)
+     * @return Rotated word
+     */
+    static constexpr uint32_t rotateLeft(uint32_t value, int shift) {
+        return (value << shift) | (value >> (32 - shift));
+    }
+
+    /**
+     * ChaCha quarter round over four words of the working state
+     * @param x Working state
+     * @param a Index of the first word
+     * @param b Index of the second word
+     * @param c Index of the third word
+     * @param d Index of the fourth word
+     */
+    static void quarterRound(std::array<uint32_t, CHACHA_WORDS> &x, size_t a, size_t b, size_t c, size_t d) {
+        x[a] += x[b];
+        x[d] = rotateLeft(x[d] ^ x[a], 16);
+        x[c] += x[d];
+        x[b] = rotateLeft(x[b] ^ x[c], 12);
+        x[a] += x[b];
+        x[d] = rotateLeft(x[d] ^ x[a], 8);
+        x[c] += x[d];
+        x[b] = rotateLeft(x[b] ^ x[c], 7);
+    }
+
+    /**
+     * Computes the next block of the keystream and increments the block counter
+     */
+    void refill() {
+        auto x = mState;
+        for (int i = 0; i < CHACHA_DOUBLE_ROUNDS; i++) {
+            // Column round
+            quarterRound(x, 0, 4, 8, 12);
+            quarterRound(x, 1, 5, 9, 13);
+            quarterRound(x, 2, 6, 10, 14);
+            quarterRound(x, 3, 7, 11, 15);
+            // Diagonal round
+            quarterRound(x, 0, 5, 10, 15);
+            quarterRound(x, 1, 6, 11, 12);
+            quarterRound(x, 2, 7, 8, 13);
+            quarterRound(x, 3, 4, 9, 14);
+        }
+        for (size_t i = 0; i < CHACHA_WORDS; i++)
+            mBlock[i] = x[i] + mState[i];
+
+        // 64-bit block counter in the words 12 and 13
+        if (!++mState[12])
+            mState[13]++;
+        mPosition = 0;
+    }
+
+public:
+    /**
+     * Constructor for the ChaCha20Rng class with the given key and nonce
+     * @param key Key (256 bits)
+     * @param nonce Nonce
+     */
+    ChaCha20Rng(const std::array<uint32_t, 8> &key, uint64_t nonce) : mState(), mBlock(), mPosition(CHACHA_WORDS) {
+        for (size_t i = 0; i < 4; i++)
+            mState[i] = CHACHA_CONSTANTS[i];
+        for (size_t i = 0; i < key.size(); i++)
+            mState[4 + i] = key[i];
+        mState[14] = static_cast<uint32_t>(nonce);
+        mState[15] = static_cast<uint32_t>(nonce >> 32);
+    }
+
+    /**
+     * Constructor for the ChaCha20Rng class, the key and the nonce are taken from std::random_device
+     */
+    ChaCha20Rng() : ChaCha20Rng(seed(), 0) {
+        // Nothing to do here :)
+    }
+
+    /**
+     * Draws a fresh key from the system entropy source
+     * @return Key (256 bits)
+     */
+    static std::array<uint32_t, 8> seed() {
+        std::random_device device;
+        std::array<uint32_t, 8> key{};
+        for (auto &word : key)
+            word = device();
+        return key;
+    }
+
+    /**
+     * Smallest generated value
+     * @return 0
+     */
+    static constexpr result_type min() {
+        return 0;
+    }
+
+    /**
+     * Largest generated value
+     * @return 2^32 - 1
+     */
+    static constexpr result_type max() {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    /**
+     * Generates the next random word
+     * @return Random word
+     */
+    result_type operator()() {
+        if (mPosition == CHACHA_WORDS)
+            refill();
+        return mBlock[mPosition++];
+    }
+
+    /**
+     * Fills the words with random values
+     * @param words Words
+     * @param count Number of the words
+     */
+    void fill(uint32_t *words, size_t count) {
+        for (size_t i = 0; i < count; i++)
+            words[i] = (*this)();
+    }
+};
+
+/**
+ * Random generator of the calling thread (seeded on the first use in the thread)
+ * @return Generator of the thread
+ */
+inline ChaCha20Rng &thread_rng() {
+    thread_local ChaCha20Rng rng;
+    return rng;
+}
+
+/**
+ * Generates a uniform random number from the range [0, bound)
+ * @param bound Upper bound (exclusive, positive)
+ * @param rng Random generator
+ * @return Random number smaller than the bound
+ */
+inline uint32_t random_below(uint32_t bound, ChaCha20Rng &rng = thread_rng()) {
+    if (!bound)
+        throw std::invalid_argument("Upper bound of the random number has to be positive");
+
+    // Lemire's multiply and reject, the rejected zone is smaller than the bound
+    uint64_t product = static_cast<uint64_t>(rng()) * bound;
+    if (static_cast<uint32_t>(product) < bound) {
+        const uint32_t threshold = (0 - bound) % bound;
+        while (static_cast<uint32_t>(product) < threshold)
+            product = static_cast<uint64_t>(rng()) * bound;
+    }
+    return static_cast<uint32_t>(product >> 32);
+}
+
+/**
+ * Computes base^exponent mod modulus for 32-bit numbers
+ * @param base Base
+ * @param exponent Exponent
+ * @param modulus Modulus
+ * @return base^exponent mod modulus
+ */
+constexpr uint32_t pow_mod_u32(uint64_t base, uint32_t exponent, uint32_t modulus) {
+    uint64_t res = 1;
+    base %= modulus;
+    while (exponent) {
+        if (exponent & 1)
+            res = res * base % modulus;
+        base = base * base % modulus;
+        exponent >>= 1;
+    }
+    return static_cast<uint32_t>(res);
+}
+
+/**
+ * Deterministic Miller-Rabin test of a 32-bit number (bases 2, 7 and 61 are enough below 2^32)
+ * @param n Number to check
+ * @return True if the number is prime, false otherwise
+ */
+constexpr bool is_prime_u32(uint32_t n) {
+    if (n < 2)
+        return false;
+    for (uint32_t small : {2u, 3u, 5u, 7u, 61u}) {
+        if (n % small == 0)
+            return n == small;
+    }
+
+    uint32_t d = n - 1;
+    int s = 0;
+    while (!(d & 1)) {
+        d >>= 1;
+        s++;
+    }
+    for (uint32_t base : {2u, 7u, 61u}) {
+        uint64_t x = pow_mod_u32(base, d, n);
+        if (x == 1 || x == n - 1)
+            continue;
+        bool composite = true;
+        for (int i = 1; i < s && composite; i++) {
+            x = x * x % n;
+            composite = x != n - 1;
+        }
+        if (composite)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Generates a uniform random prime number from the range [3, upper_limit]
+ * @param upper_limit Upper limit of the prime number (at least 3)
+ * @param rng Random generator
+ * @return Random prime number
+ */
+inline uint32_t random_prime(uint32_t upper_limit, ChaCha20Rng &rng = thread_rng()) {
+    if (upper_limit < 3)
+        throw std::invalid_argument("There is no prime number between 3 and " + std::to_string(upper_limit));
+
+    // Primes are dense enough (1 / ln(2^32) ~ 1 / 22), candidates are drawn until one is prime
+    uint32_t res;
+    do {
+        res = 3 + random_below(upper_limit - 2, rng);
+    } while (!is_prime_u32(res));
+    return res;
+}
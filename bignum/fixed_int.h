@@ -0,0 +1,345 @@
+#pragma once
+
+#include <array>
+#include <utility>
+#include <compare>
+#include <stdexcept>
+#include <bit>
+#include <cstdint>
+#include "my_big_int.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+/**
+ * Adds two words and a carry
+ * @param a Word
+ * @param b Word
+ * @param carry Incoming carry (0 or 1), outgoing carry is stored here
+ * @return Sum modulo 2^64
+ */
+constexpr uint64_t add_carry(uint64_t a, uint64_t b, uint64_t &carry) {
+#if defined(__x86_64__) || defined(_M_X64)
+    // Compilers don't recognize the carry chain in the portable code, the intrinsic is one adc instruction
+    if !consteval {
+        unsigned long long res;
+        carry = _addcarry_u64(static_cast<unsigned char>(carry), a, b, &res);
+        return res;
+    }
+#endif
+    const uint64_t sum = a + carry;
+    const uint64_t res = sum + b;
+    // At most one of the two additions wraps around
+    carry = (sum < a) | (res < b);
+    return res;
+}
+
+/**
+ * Subtracts a word and a borrow from a word
+ * @param a Word
+ * @param b Word
+ * @param borrow Incoming borrow (0 or 1), outgoing borrow is stored here
+ * @return Difference modulo 2^64
+ */
+constexpr uint64_t sub_borrow(uint64_t a, uint64_t b, uint64_t &borrow) {
+#if defined(__x86_64__) || defined(_M_X64)
+    // One sbb instruction (see add_carry())
+    if !consteval {
+        unsigned long long res;
+        borrow = _subborrow_u64(static_cast<unsigned char>(borrow), a, b, &res);
+        return res;
+    }
+#endif
+    const uint64_t diff = a - b;
+    const uint64_t res = diff - borrow;
+    borrow = (a < b) | (diff < borrow);
+    return res;
+}
+
+/**
+ * Multiplies two words and adds a word and a carry (a * b + c + carry fits into 128 bits)
+ * @param a Word
+ * @param b Word
+ * @param c Word
+ * @param carry Incoming carry word, the upper word of the result is stored here
+ * @return Lower word of the result
+ */
+constexpr uint64_t mul_add_carry(uint64_t a, uint64_t b, uint64_t c, uint64_t &carry) {
+#ifdef __SIZEOF_INT128__
+    const unsigned __int128 res = static_cast<unsigned __int128>(a) * b + c + carry;
+    carry = static_cast<uint64_t>(res >> 64);
+    return static_cast<uint64_t>(res);
+#else
+    // Product of the 32-bit halves (schoolbook with four partial products)
+    const uint64_t a_low = a & 0xFFFFFFFF, a_high = a >> 32, b_low = b & 0xFFFFFFFF, b_high = b >> 32;
+    const uint64_t low = a_low * b_low, cross1 = a_high * b_low, cross2 = a_low * b_high;
+    const uint64_t middle = (low >> 32) + (cross1 & 0xFFFFFFFF) + (cross2 & 0xFFFFFFFF);
+    uint64_t high = a_high * b_high + (cross1 >> 32) + (cross2 >> 32) + (middle >> 32);
+    uint64_t res = (middle << 32) | (low & 0xFFFFFFFF);
+    res += c;
+    high += res < c;
+    res += carry;
+    high += res < carry;
+    carry = high;
+    return res;
+#endif
+}
+
+/**
+ * Calls the function for all indices 0 .. Count - 1 (the calls are expanded at compile time, there is no loop)
+ * @param f Function taking the index as std::integral_constant
+ * @tparam Count Number of indices
+ * @tparam F Type of the function
+ */
+template<size_t Count, typename F>
+constexpr void unrolled(F &&f) {
+    [&]<size_t... I>(std::index_sequence<I...>) {
+        (f(std::integral_constant<size_t, I>{}), ...);
+    }(std::make_index_sequence<Count>{});
+}
+
+/**
+ * Non-negative integer with a fixed width of Words 64-bit words (256, 384, 512 bits, ...)
+ * Words are stored in std::array (the least significant first), there is no size, no leading zero trimming and
+ * no allocation, all operations are unrolled for the given width (straight-line code with carry chains)
+ * Addition and subtraction wrap around modulo 2^(64 * Words) and report the outgoing carry (borrow) instead
+ * @tparam Words Number of 64-bit words
+ */
+template<size_t Words>
+class FixedInt {
+    static_assert(Words > 0, "FixedInt needs at least one word");
+
+    template<size_t> friend class FixedInt;
+
+private:
+    /** Words of the number (the least significant first) */
+    std::array<uint64_t, Words> mWords;
+
+public:
+    /** Number of bits */
+    static constexpr uint64_t BITS = 64 * Words;
+
+    /**
+     * Constructor for the FixedInt class, the number is zero
+     */
+    constexpr FixedInt() : mWords() {
+        // Nothing to do here :)
+    }
+
+    /**
+     * Constructor for the FixedInt class based on a given word
+     * @param value Value
+     */
+    explicit constexpr FixedInt(uint64_t value) : mWords() {
+        mWords[0] = value;
+    }
+
+    /**
+     * Constructor for the FixedInt class based on MPInt with binary limbs
+     * @param num Non-negative number with at most BITS bits
+     * @tparam max_digits Maximum number of digits of the MPInt
+     */
+    template<ValidDigit T, T max_digits>
+    explicit constexpr FixedInt(const MPInt<T, max_digits, BinaryLimbs> &num) : mWords() {
+        if (num.getSign() < 0 && !num.isZero())
+            throw std::invalid_argument("FixedInt can't hold a negative number");
+        if (num.bitLength() > BITS)
+            throw std::invalid_argument("Number with " + std::to_string(num.bitLength()) + " bits doesn't fit into " +
+                                        std::to_string(BITS) + " bits");
+        const auto &limbs = num.getNumber();
+        for (size_t i = 0; i < limbs.size(); i++)
+            mWords[i / 2] |= static_cast<uint64_t>(limbs[i]) << (i % 2 * 32);
+    }
+
+    /**
+     * Converts the number to MPInt with binary limbs
+     * @tparam Num MPInt with binary limbs
+     * @return Number
+     */
+    template<typename Num>
+    [[nodiscard]] constexpr Num to() const {
+        typename Num::Storage limbs(2 * Words, 0);
+        for (size_t i = 0; i < 2 * Words; i++)
+            limbs[i] = static_cast<uint32_t>(mWords[i / 2] >> (i % 2 * 32));
+        size_t size = 2 * Words;
+        while (size > 1 && !limbs[size - 1])
+            size--;
+        limbs.resize(size);
+        return {std::move(limbs), 1};
+    }
+
+    /**
+     * Adds the other number in place
+     * @param other Other number
+     * @return Outgoing carry (1 if the sum doesn't fit and wrapped around)
+     */
+    constexpr uint64_t addIn(const FixedInt &other) {
+        uint64_t carry = 0;
+        unrolled<Words>([&](auto i) {
+            mWords[i] = add_carry(mWords[i], other.mWords[i], carry);
+        });
+        return carry;
+    }
+
+    /**
+     * Subtracts the other number in place
+     * Only the lowest Active words are subtracted, the result is exact if the higher words of both numbers are zero
+     * (shorter carry chain for numbers known to be small)
+     * @param other Other number
+     * @tparam Active Number of the lowest words that are subtracted
+     * @return Outgoing borrow (1 if the other number was bigger and the difference wrapped around)
+     */
+    template<size_t Active = Words>
+    constexpr uint64_t subIn(const FixedInt &other) {
+        static_assert(Active > 0 && Active <= Words, "Invalid number of active words");
+        uint64_t borrow = 0;
+        unrolled<Active>([&](auto i) {
+            mWords[i] = sub_borrow(mWords[i], other.mWords[i], borrow);
+        });
+        return borrow;
+    }
+
+    /**
+     * Replaces the number with the other one if the condition holds (without a branch, the words are blended by a mask)
+     * Only the lowest Active words are replaced (the higher words of both numbers are known to be equal)
+     * @param other Other number
+     * @param condition Condition
+     * @tparam Active Number of the lowest words that are replaced
+     */
+    template<size_t Active = Words>
+    constexpr void select(const FixedInt &other, bool condition) {
+        static_assert(Active > 0 && Active <= Words, "Invalid number of active words");
+        const uint64_t mask = 0 - static_cast<uint64_t>(condition);
+        unrolled<Active>([&](auto i) {
+            mWords[i] ^= (mWords[i] ^ other.mWords[i]) & mask;
+        });
+    }
+
+    /**
+     * Overloaded operator += for addition (modulo 2^BITS, see addIn())
+     * @param other Other number
+     * @return This number
+     */
+    constexpr FixedInt &operator+=(const FixedInt &other) {
+        addIn(other);
+        return *this;
+    }
+
+    /**
+     * Overloaded operator -= for subtraction (modulo 2^BITS, see subIn())
+     * @param other Other number
+     * @return This number
+     */
+    constexpr FixedInt &operator-=(const FixedInt &other) {
+        subIn(other);
+        return *this;
+    }
+
+    /**
+     * Overloaded operator + for addition (modulo 2^BITS)
+     * @param other Other number
+     * @return Sum
+     */
+    constexpr FixedInt operator+(const FixedInt &other) const {
+        auto res = *this;
+        res.addIn(other);
+        return res;
+    }
+
+    /**
+     * Overloaded operator - for subtraction (modulo 2^BITS)
+     * @param other Other number
+     * @return Difference
+     */
+    constexpr FixedInt operator-(const FixedInt &other) const {
+        auto res = *this;
+        res.subIn(other);
+        return res;
+    }
+
+    /**
+     * Full product of two fixed-width numbers (product scanning with both loops unrolled, never overflows)
+     * @param other Other number
+     * @tparam OtherWords Number of words of the other number
+     * @return Product with Words + OtherWords words
+     */
+    template<size_t OtherWords>
+    [[nodiscard]] constexpr FixedInt<Words + OtherWords> mulWide(const FixedInt<OtherWords> &other) const {
+        FixedInt<Words + OtherWords> res;
+        unrolled<OtherWords>([&](auto j) {
+            uint64_t carry = 0;
+            unrolled<Words>([&](auto i) {
+                res.mWords[i + j] = mul_add_carry(mWords[i], other.mWords[j], res.mWords[i + j], carry);
+            });
+            res.mWords[j + Words] = carry;
+        });
+        return res;
+    }
+
+    /**
+     * Overloaded spaceship operator <=> for comparison
+     * Both differences are computed and only their borrows are used, so there is no branch on the words
+     * @param other Other number
+     * @return Result of the comparison
+     */
+    constexpr std::strong_ordering operator<=>(const FixedInt &other) const {
+        uint64_t less = 0, greater = 0;
+        unrolled<Words>([&](auto i) {
+            sub_borrow(mWords[i], other.mWords[i], less);
+            sub_borrow(other.mWords[i], mWords[i], greater);
+        });
+        return greater <=> less;
+    }
+
+    /**
+     * Overloaded operator == for equality
+     * @param other Other number
+     * @return True if the numbers are equal
+     */
+    constexpr bool operator==(const FixedInt &other) const = default;
+
+    /**
+     * Returns the number of bits of the number (position of the highest set bit + 1, 0 for zero)
+     * @return Number of bits
+     */
+    [[nodiscard]] constexpr uint64_t bitLength() const {
+        for (size_t i = Words; i-- > 0;) {
+            if (mWords[i])
+                return 64 * i + std::bit_width(mWords[i]);
+        }
+        return 0;
+    }
+
+    /**
+     * Returns the number of used words (index of the highest non-zero word + 1, at least 1)
+     * @return Number of words
+     */
+    [[nodiscard]] constexpr size_t wordLength() const {
+        size_t length = Words;
+        while (length > 1 && !mWords[length - 1])
+            length--;
+        return length;
+    }
+
+    /**
+     * Checks if the number is zero
+     * @return True if the number is zero
+     */
+    [[nodiscard]] constexpr bool isZero() const {
+        uint64_t any = 0;
+        unrolled<Words>([&](auto i) {
+            any |= mWords[i];
+        });
+        return !any;
+    }
+
+    /**
+     * Getter for one word of the number
+     * @param index Index of the word (the least significant one is 0)
+     * @return Word
+     */
+    [[nodiscard]] constexpr uint64_t word(size_t index) const {
+        return mWords[index];
+    }
+};
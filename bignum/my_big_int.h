@@ -0,0 +1,2972 @@
+#pragma once
+
+#include <iostream>
+#include <utility>
+#include <vector>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <sstream>
+#include <algorithm>
+#include <array>
+#include <span>
+#include <bit>
+#include <concepts>
+#include <iterator>
+#include <stdexcept>
+#include <cstdlib>
+#include <thread>
+
+/**
+ * Base 1 000 000 000 was chosen because it is the largest base that can be stored in 32 bits
+ * Conveniently, it is also the largest base that can be multiplied by itself without overflowing
+ * and can be stored in 64 bits
+ * This is similar to string approach, but with base 1 000 000 000, we do operations with 9 digits at a time
+ */
+constexpr uint32_t BASE = 1000000000;
+/**
+ * Number of digits in base 1 000 000 000 (max number is 999 999 999)
+ */
+constexpr uint8_t MAX_DIGITS = 9;
+/**
+ * Constant used for the UNLIMITED template parameter
+ */
+constexpr int8_t UNLIMITED = -1;
+
+/**
+ * Operand sizes (in digits) from which the faster multiplication algorithms are used
+ * Every limb backend has its own values (MUL_THRESHOLDS), they were measured by mul_tuning (see mul_tuning.cpp), run
+ * it again on a different machine
+ * If toom3 is not smaller than ntt, Toom-3 only splits the products longer than NTT_MAX_LENGTH
+ */
+struct MulThresholds {
+    /** Smaller operand with at least this many digits is multiplied by Karatsuba */
+    size_t karatsuba;
+    /** Smaller operand with at least this many digits is multiplied by Toom-3 */
+    size_t toom3;
+    /** Smaller operand with at least this many digits is multiplied by the number theoretic transform */
+    size_t ntt;
+};
+
+/**
+ * Limb backend with the decimal base 1 000 000 000 (see BASE)
+ * Conversion from and to decimal strings is linear, but every bit operation needs a real division
+ */
+struct DecimalLimbs {
+    /** Base of one limb */
+    static constexpr uint64_t BASE = ::BASE;
+    /** Flag whether the base is a power of two */
+    static constexpr bool BINARY = false;
+    /** Thresholds of the multiplication (the NTT pays off before Toom-3 does, so Toom-3 is only the splitter) */
+    static constexpr MulThresholds MUL_THRESHOLDS = {33, 500, 500};
+};
+
+/**
+ * Limb backend with the binary base 2^32
+ * Bit operations are native shifts and masks, decimal strings are converted only at I/O boundaries
+ */
+struct BinaryLimbs {
+    /** Base of one limb */
+    static constexpr uint64_t BASE = 1ull << 32;
+    /** Flag whether the base is a power of two */
+    static constexpr bool BINARY = true;
+    /** Thresholds of the multiplication */
+    static constexpr MulThresholds MUL_THRESHOLDS = {41, 571, 1906};
+};
+
+/**
+ * Concept for checking if a type describes the base of the limbs (32 bit digits) of the MPInt
+ * @tparam L Type to check
+ */
+template<typename L>
+concept LimbBackend = requires {
+    { L::BASE } -> std::convertible_to<uint64_t>;
+    { L::BINARY } -> std::convertible_to<bool>;
+    { L::MUL_THRESHOLDS } -> std::convertible_to<MulThresholds>;
+};
+
+/**
+ * Number of digits of unlimited MPInt instances stored inline (without heap allocation)
+ * 18 digits hold 512 bits in both bases (2^512 < 10^162 = (10^9)^18)
+ */
+constexpr size_t SMALL_BUFFER_DIGITS = 18;
+
+/**
+ * Storage of the digits of an arbitrary precision integer (vector with inline buffer for N digits)
+ * Numbers with at most N digits live in the inline std::array and need no heap allocation at all
+ * Bigger numbers move to the heap and stay there (the capacity is reused when the number shrinks and grows again)
+ * Only the part of the std::vector interface needed by the arithmetic is implemented
+ * @tparam N Number of digits in the inline buffer
+ */
+template<size_t N>
+class LimbStorage {
+private:
+    /** Inline buffer of digits */
+    std::array<uint32_t, N> mInline;
+    /** Heap buffer of digits (its size is the capacity), empty while the inline buffer is used */
+    std::vector<uint32_t> mHeap;
+    /** Number of digits */
+    size_t mSize;
+
+public:
+    constexpr LimbStorage() : mInline(), mHeap(), mSize(0) {
+        // Nothing to do here :)
+    }
+
+    /**
+     * Constructor for the LimbStorage class with the given number of same digits
+     * @param size Number of digits
+     * @param value Value of all digits
+     */
+    constexpr LimbStorage(size_t size, uint32_t value) : LimbStorage() {
+        assign(size, value);
+    }
+
+    /**
+     * Constructor for the LimbStorage class based on a list of digits
+     * @param digits Digits (the least significant first)
+     */
+    constexpr LimbStorage(std::initializer_list<uint32_t> digits) : LimbStorage() {
+        assign(digits.begin(), digits.end());
+    }
+
+    /**
+     * Constructor for the LimbStorage class based on a range of digits
+     * @param first Iterator to the first digit (the least significant one)
+     * @param last Iterator behind the last digit
+     */
+    template<std::input_iterator It>
+    constexpr LimbStorage(It first, It last) : LimbStorage() {
+        assign(first, last);
+    }
+
+    /**
+     * Constructor for the LimbStorage class based on another container of digits (std::vector or other LimbStorage)
+     * @param digits Container of digits (the least significant first)
+     */
+    template<typename Digits>
+    requires requires(const Digits &d) { d.begin(); d.end(); d.size(); } &&
+             (!std::is_same_v<std::remove_cvref_t<Digits>, LimbStorage>)
+    constexpr LimbStorage(const Digits &digits) : LimbStorage() { // NOLINT(google-explicit-constructor)
+        assign(digits.begin(), digits.end());
+    }
+
+    /**
+     * Copy constructor for the LimbStorage class, small numbers are copied to the inline buffer only
+     * @param other LimbStorage instance to copy
+     */
+    constexpr LimbStorage(const LimbStorage &other) : LimbStorage() {
+        assign(other.begin(), other.end());
+    }
+
+    /**
+     * Move constructor for the LimbStorage class, heap buffer is taken over
+     * @param other LimbStorage instance to move
+     */
+    constexpr LimbStorage(LimbStorage &&other) noexcept: mInline(other.mInline), mHeap(std::move(other.mHeap)),
+                                               mSize(other.mSize) {
+        other.mHeap.clear();
+        other.mSize = 0;
+    }
+
+    /**
+     * Copy assignment operator for the LimbStorage class, own buffer is reused
+     * @param other LimbStorage instance to copy
+     * @return This instance
+     */
+    constexpr LimbStorage &operator=(const LimbStorage &other) {
+        if (this != &other)
+            assign(other.begin(), other.end());
+        return *this;
+    }
+
+    /**
+     * Move assignment operator for the LimbStorage class, heap buffer is taken over (if the other one has one)
+     * @param other LimbStorage instance to move
+     * @return This instance
+     */
+    constexpr LimbStorage &operator=(LimbStorage &&other) noexcept {
+        if (this == &other)
+            return *this;
+        if (other.mHeap.empty()) {
+            std::copy(other.mInline.begin(), other.mInline.begin() + static_cast<long>(other.mSize), data());
+        } else {
+            mHeap = std::move(other.mHeap);
+            other.mHeap.clear();
+        }
+        mSize = other.mSize;
+        other.mSize = 0;
+        return *this;
+    }
+
+    /**
+     * Replaces the digits with the given number of same digits
+     * @param size Number of digits
+     * @param value Value of all digits
+     */
+    constexpr void assign(size_t size, uint32_t value) {
+        reserve(size);
+        std::fill(data(), data() + size, value);
+        mSize = size;
+    }
+
+    /**
+     * Replaces the digits with a range of digits
+     * @param first Iterator to the first digit
+     * @param last Iterator behind the last digit
+     */
+    template<std::input_iterator It>
+    constexpr void assign(It first, It last) {
+        auto size = static_cast<size_t>(std::distance(first, last));
+        reserve(size);
+        std::copy(first, last, data());
+        mSize = size;
+    }
+
+    /**
+     * Makes sure the storage can hold the given number of digits without another allocation
+     * @param capacity Number of digits
+     */
+    constexpr void reserve(size_t capacity) {
+        if (capacity <= this->capacity())
+            return;
+        std::vector<uint32_t> heap(std::max(capacity, 2 * this->capacity()));
+        std::copy(data(), data() + mSize, heap.begin());
+        mHeap = std::move(heap);
+    }
+
+    /**
+     * Changes the number of digits, new digits get the given value
+     * @param size Number of digits
+     * @param value Value of the new digits
+     */
+    constexpr void resize(size_t size, uint32_t value = 0) {
+        reserve(size);
+        if (size > mSize)
+            std::fill(data() + mSize, data() + size, value);
+        mSize = size;
+    }
+
+    /**
+     * Adds a digit to the end (as the most significant digit)
+     * @param digit Digit
+     */
+    constexpr void push_back(uint32_t digit) {
+        if (mSize == capacity())
+            reserve(mSize + 1);
+        data()[mSize++] = digit;
+    }
+
+    /**
+     * Removes the last (the most significant) digit
+     */
+    constexpr void pop_back() {
+        mSize--;
+    }
+
+    /**
+     * Removes the digits in the range
+     * @param first Iterator to the first removed digit
+     * @param last Iterator behind the last removed digit
+     * @return Iterator to the digit behind the removed ones
+     */
+    constexpr uint32_t *erase(const uint32_t *first, const uint32_t *last) {
+        auto *begin = data() + (first - data());
+        std::copy(last, static_cast<const uint32_t *>(end()), begin);
+        mSize -= last - first;
+        return begin;
+    }
+
+    /**
+     * Removes all digits (capacity is kept)
+     */
+    constexpr void clear() {
+        mSize = 0;
+    }
+
+    /** @return Number of digits */
+    [[nodiscard]] constexpr size_t size() const { return mSize; }
+
+    /** @return True if there are no digits */
+    [[nodiscard]] constexpr bool empty() const { return mSize == 0; }
+
+    /** @return Number of digits that fit without another allocation */
+    [[nodiscard]] constexpr size_t capacity() const { return mHeap.empty() ? N : mHeap.size(); }
+
+    /** @return Pointer to the digits */
+    constexpr uint32_t *data() { return mHeap.empty() ? mInline.data() : mHeap.data(); }
+
+    /** @return Pointer to the digits */
+    [[nodiscard]] constexpr const uint32_t *data() const { return mHeap.empty() ? mInline.data() : mHeap.data(); }
+
+    /** @return Iterator to the first digit */
+    constexpr uint32_t *begin() { return data(); }
+
+    /** @return Iterator behind the last digit */
+    constexpr uint32_t *end() { return data() + mSize; }
+
+    /** @return Iterator to the first digit */
+    [[nodiscard]] constexpr const uint32_t *begin() const { return data(); }
+
+    /** @return Iterator behind the last digit */
+    [[nodiscard]] constexpr const uint32_t *end() const { return data() + mSize; }
+
+    /** @return The most significant digit */
+    constexpr uint32_t &back() { return data()[mSize - 1]; }
+
+    /** @return The most significant digit */
+    [[nodiscard]] constexpr const uint32_t &back() const { return data()[mSize - 1]; }
+
+    /**
+     * @param index Index of the digit
+     * @return Digit
+     */
+    constexpr uint32_t &operator[](size_t index) { return data()[index]; }
+
+    /**
+     * @param index Index of the digit
+     * @return Digit
+     */
+    constexpr const uint32_t &operator[](size_t index) const { return data()[index]; }
+
+    /**
+     * Compares the digits with another container of digits (std::vector or other LimbStorage)
+     * @param other Container of digits
+     * @return True if the digits are the same
+     */
+    template<typename Digits>
+    constexpr bool operator==(const Digits &other) const {
+        return std::equal(begin(), end(), other.begin(), other.end());
+    }
+};
+
+/**
+ * Concept for checking if a type is integral and if the variable is either UNLIMITED or >= 4 bytes (~9 digits)
+ * @tparam T Type to check
+ */
+template<typename T>
+concept ValidDigit = requires(T t) {
+    std::is_integral_v<T>;
+    t >= MAX_DIGITS || t == UNLIMITED; // 4 byte number ~ 9 digit number (thus MAX_DIGITS)
+};
+
+/**
+ * Struct for storing the result of a maximum of two ValidDigit variables
+ * The biggest possible is UNLIMITED (if at least one is UNLIMITED)
+ * Otherwise the bigger of the two is stored
+ * @tparam x ValidDigit variable to be chosen from
+ * @tparam y ValidDigit variable to be chosen from
+ */
+template<int32_t x, int32_t y> requires ValidDigit<int32_t>
+struct MaxDigits {
+    /**
+     * The biggest possible is UNLIMITED (if at least one is UNLIMITED)
+     * Otherwise the bigger of the two is stored
+     */
+    static const int32_t value = (x == UNLIMITED || y == UNLIMITED) ? UNLIMITED : (x > y) ? x : y;
+};
+
+/**
+ * Addition of two arbitrary precision integers is fairly simple
+ * We just add the digits from the least significant digit to the most significant digit
+ * If the sum of two digits is greater than the base, we carry the 1 to the next digit
+ * @param num1 Number to be added
+ * @param num2 Number to be added
+ * @tparam Limbs Base of the digits
+ * @tparam Digits1 Container of the digits of num1 and of the result (std::vector or LimbStorage)
+ * @tparam Digits2 Container of the digits of num2
+ * @return Vector of digits representing the sum of num1 and num2
+ */
+template<LimbBackend Limbs = DecimalLimbs, typename Digits1 = std::vector<uint32_t>, typename Digits2 = std::vector<uint32_t>>
+constexpr Digits1 add(const Digits1 &num1, const Digits2 &num2) {
+    Digits1 result_number;
+
+    uint8_t carry = 0;
+    for (size_t i = 0; i < num1.size() || i < num2.size() || carry; i++) {
+        // If there is no digit in either of the numbers, add 0 instead
+        // 64 bit sum is needed for the base 2^32
+        uint64_t sum = static_cast<uint64_t>(num1.size() > i ? num1[i] : 0) +
+                       (num2.size() > i ? num2[i] : 0) + carry;
+        // Carry is the integer part of the sum divided by the base (either 0 or 1)
+        carry = sum / Limbs::BASE;
+        // Sum is the remainder of the sum divided by the base
+        sum %= Limbs::BASE;
+        result_number.push_back(sum);
+    }
+
+    return result_number;
+}
+
+/**
+ * Subtraction of two arbitrary precision integers is fairly simple as well
+ * We just subtract the digits from the least significant digit to the most significant digit
+ * If the difference of two digits is negative, we borrow 1 from the next digit
+ * It is expected that num1 is greater than num2
+ * @param num1 Number to be subtracted from
+ * @param num2 Number to be subtracted
+ * @tparam Limbs Base of the digits
+ * @tparam Digits1 Container of the digits of num1 and of the result (std::vector or LimbStorage)
+ * @tparam Digits2 Container of the digits of num2
+ * @return Vector of digits representing the difference of num1 and num2
+ */
+template<LimbBackend Limbs = DecimalLimbs, typename Digits1 = std::vector<uint32_t>, typename Digits2 = std::vector<uint32_t>>
+constexpr Digits1 sub(const Digits1 &num1, const Digits2 &num2) {
+    Digits1 result_number;
+
+    uint8_t carry = 0;
+    for (size_t i = 0; i < num1.size() || carry; i++) {
+        // Since the num1 is always greater than num2, we can assume that num1 has a digit at index i (always)
+        // If there is no digit in num2, subtract 0 instead
+        auto sum = static_cast<int64_t>(num1[i]) - (num2.size() > i ? num2[i] : 0) - carry;
+        // Carry 1 to the next iteration if the difference is negative
+        carry = sum < 0;
+        // If the difference is negative, add the base to it
+        sum += static_cast<int64_t>(carry * Limbs::BASE);
+        result_number.push_back(sum);
+    }
+
+    // Remove the leading zeros from the result
+    while (result_number.size() > 1 && result_number.back() == 0)
+        result_number.pop_back();
+
+    return result_number;
+}
+
+/**
+ * Addition of two arbitrary precision integers in place (num1 += num2)
+ * Digits of num1 are reused, so no allocation is needed unless num1 has to grow over its capacity
+ * @param num1 Number to be added to (result is stored here)
+ * @param num2 Number to be added (can be num1 itself)
+ * @tparam Limbs Base of the digits
+ * @tparam Digits1 Container of the digits of num1 (std::vector or LimbStorage)
+ * @tparam Digits2 Container of the digits of num2
+ */
+template<LimbBackend Limbs = DecimalLimbs, typename Digits1, typename Digits2>
+constexpr void add_in_place(Digits1 &num1, const Digits2 &num2) {
+    // Size is read before num1 grows, num2 might be the same container
+    const size_t size2 = num2.size();
+    if (num1.size() < size2)
+        num1.resize(size2, 0);
+
+    uint64_t carry = 0;
+    for (size_t i = 0; i < num1.size() && (i < size2 || carry); i++) {
+        uint64_t sum = static_cast<uint64_t>(num1[i]) + (i < size2 ? num2[i] : 0) + carry;
+        carry = sum / Limbs::BASE;
+        num1[i] = sum % Limbs::BASE;
+    }
+    if (carry)
+        num1.push_back(carry);
+}
+
+/**
+ * Subtraction of two arbitrary precision integers in place (num1 -= num2)
+ * It is expected that num1 is greater than or equal to num2
+ * @param num1 Number to be subtracted from (result is stored here)
+ * @param num2 Number to be subtracted (can be num1 itself)
+ * @tparam Limbs Base of the digits
+ * @tparam Digits1 Container of the digits of num1 (std::vector or LimbStorage)
+ * @tparam Digits2 Container of the digits of num2
+ */
+template<LimbBackend Limbs = DecimalLimbs, typename Digits1, typename Digits2>
+constexpr void sub_in_place(Digits1 &num1, const Digits2 &num2) {
+    const size_t size2 = num2.size();
+    int64_t borrow = 0;
+    for (size_t i = 0; i < num1.size() && (i < size2 || borrow); i++) {
+        auto diff = static_cast<int64_t>(num1[i]) - (i < size2 ? num2[i] : 0) - borrow;
+        borrow = diff < 0;
+        num1[i] = diff + borrow * static_cast<int64_t>(Limbs::BASE);
+    }
+
+    // Remove the leading zeros from the result
+    while (num1.size() > 1 && num1.back() == 0)
+        num1.pop_back();
+}
+
+/**
+ * Reversed subtraction of two arbitrary precision integers in place (num1 = num2 - num1)
+ * It is expected that num2 is greater than num1
+ * @param num1 Number to be subtracted (result is stored here)
+ * @param num2 Number to be subtracted from
+ * @tparam Limbs Base of the digits
+ * @tparam Digits1 Container of the digits of num1 (std::vector or LimbStorage)
+ * @tparam Digits2 Container of the digits of num2
+ */
+template<LimbBackend Limbs = DecimalLimbs, typename Digits1, typename Digits2>
+constexpr void sub_reverse_in_place(Digits1 &num1, const Digits2 &num2) {
+    num1.resize(num2.size(), 0);
+    int64_t borrow = 0;
+    for (size_t i = 0; i < num2.size(); i++) {
+        auto diff = static_cast<int64_t>(num2[i]) - num1[i] - borrow;
+        borrow = diff < 0;
+        num1[i] = diff + borrow * static_cast<int64_t>(Limbs::BASE);
+    }
+
+    // Remove the leading zeros from the result
+    while (num1.size() > 1 && num1.back() == 0)
+        num1.pop_back();
+}
+
+/**
+ * Returns the number of digits without the leading zeros (at least 1)
+ * @param num Digits
+ * @param size Number of digits
+ * @return Number of significant digits
+ */
+constexpr size_t limbs_length(const uint32_t *num, size_t size) {
+    while (size > 1 && num[size - 1] == 0)
+        size--;
+    return size;
+}
+
+/**
+ * Adds a number to another number in place (num1 += num2)
+ * It is expected that the sum fits into size1 digits
+ * @param num1 Number to be added to (result is stored here)
+ * @param size1 Number of digits of num1
+ * @param num2 Number to be added
+ * @param size2 Number of digits of num2
+ * @tparam Limbs Base of the digits
+ */
+template<LimbBackend Limbs = DecimalLimbs>
+constexpr void limbs_add_in(uint32_t *num1, size_t size1, const uint32_t *num2, size_t size2) {
+    uint64_t carry = 0;
+    for (size_t i = 0; i < size1 && (i < size2 || carry); i++) {
+        uint64_t sum = static_cast<uint64_t>(num1[i]) + (i < size2 ? num2[i] : 0) + carry;
+        carry = sum / Limbs::BASE;
+        num1[i] = sum % Limbs::BASE;
+    }
+}
+
+/**
+ * Subtracts a small multiple of a number from another number in place (num1 -= num2 * multiplier)
+ * It is expected that the result is not negative
+ * @param num1 Number to be subtracted from (result is stored here)
+ * @param size1 Number of digits of num1
+ * @param num2 Number to be subtracted
+ * @param size2 Number of digits of num2
+ * @param multiplier Small multiplier (smaller than the base)
+ * @tparam Limbs Base of the digits
+ */
+template<LimbBackend Limbs = DecimalLimbs>
+constexpr void limbs_sub_mul_in(uint32_t *num1, size_t size1, const uint32_t *num2, size_t size2, uint32_t multiplier = 1) {
+    uint64_t carry = 0;
+    int64_t borrow = 0;
+    for (size_t i = 0; i < size1 && (i < size2 || carry || borrow); i++) {
+        uint64_t product = (i < size2 ? static_cast<uint64_t>(num2[i]) * multiplier : 0) + carry;
+        carry = product / Limbs::BASE;
+        auto diff = static_cast<int64_t>(num1[i]) - static_cast<int64_t>(product % Limbs::BASE) - borrow;
+        borrow = diff < 0;
+        num1[i] = diff + borrow * static_cast<int64_t>(Limbs::BASE);
+    }
+}
+
+/**
+ * Divides a number by a small number in place, the division has to be exact
+ * @param num Number to be divided (result is stored here)
+ * @param size Number of digits of num
+ * @param divisor Small divisor (greater than 0)
+ * @tparam Limbs Base of the digits
+ */
+template<LimbBackend Limbs = DecimalLimbs>
+constexpr void limbs_div_exact_in(uint32_t *num, size_t size, uint32_t divisor) {
+    uint64_t carry = 0;
+    for (auto i = static_cast<int64_t>(size) - 1; i >= 0; i--) {
+        uint64_t sum = num[i] + carry * Limbs::BASE;
+        num[i] = sum / divisor;
+        carry = sum % divisor;
+    }
+}
+
+/**
+ * Evaluates a number split into three parts of k digits (a0 + a1 * B^k + a2 * B^2k) as a polynomial
+ * a0 + a1 * x + a2 * x^2 (Horner scheme)
+ * @param result Result with k + 1 digits (output)
+ * @param num Number to evaluate
+ * @param size Number of digits of num (2k < size <= 3k)
+ * @param k Number of digits of one part
+ * @param x Point to evaluate at (1, 2 or 3)
+ * @tparam Limbs Base of the digits
+ */
+template<LimbBackend Limbs = DecimalLimbs>
+constexpr void limbs_eval_toom3(uint32_t *result, const uint32_t *num, size_t size, size_t k, uint32_t x) {
+    std::fill(result, result + k + 1, 0);
+    for (auto part = 2; part >= 0; part--) {
+        uint64_t carry = 0;
+        for (size_t i = 0; i <= k; i++) {
+            uint64_t product = static_cast<uint64_t>(result[i]) * x + carry;
+            carry = product / Limbs::BASE;
+            result[i] = product % Limbs::BASE;
+        }
+        limbs_add_in<Limbs>(result, k + 1, num + part * k, std::min(k, size - part * k));
+    }
+}
+
+/**
+ * Primes of the number theoretic transform (p = c * 2^k + 1 with k >= 23 and the primitive root NTT_ROOT)
+ * Their product (> 2^86) is bigger than every coefficient of the product when the smaller operand has at most 2^22
+ * digits (2^22 * (2^32 - 1)^2 < 2^86), so the coefficients are recombined exactly by the Chinese remainder theorem
+ */
+constexpr uint32_t NTT_PRIMES[3] = {998244353, 167772161, 469762049};
+/** Primitive root modulo all NTT_PRIMES */
+constexpr uint32_t NTT_ROOT = 3;
+/** Longest transform (998244353 - 1 = 119 * 2^23 limits the length of the transform to 2^23) */
+constexpr size_t NTT_MAX_LENGTH = size_t{1} << 23;
+
+/**
+ * Computes base^exponent modulo a prime of the number theoretic transform
+ * @param base Base
+ * @param exponent Exponent
+ * @tparam P Prime
+ * @return base^exponent mod P
+ */
+template<uint32_t P>
+constexpr uint32_t ntt_pow(uint64_t base, uint64_t exponent) {
+    uint64_t res = 1;
+    base %= P;
+    while (exponent) {
+        if (exponent & 1)
+            res = res * base % P;
+        base = base * base % P;
+        exponent >>= 1;
+    }
+    return static_cast<uint32_t>(res);
+}
+
+/**
+ * Computes -P^-1 mod 2^32 (factor of the Montgomery reduction) by the Newton's iteration
+ * @tparam P Prime
+ * @return -P^-1 mod 2^32
+ */
+template<uint32_t P>
+constexpr uint32_t ntt_montgomery_factor() {
+    // Every iteration doubles the number of correct bits (P * P = 1 mod 8 for odd P)
+    uint32_t inverse = P;
+    for (int i = 0; i < 4; i++)
+        inverse *= 2 - P * inverse;
+    return 0 - inverse;
+}
+
+/**
+ * Montgomery multiplication modulo a prime of the number theoretic transform (a * b * 2^-32 mod P)
+ * One operand is kept in the Montgomery form (multiplied by 2^32), so the product is in the ordinary form,
+ * no division is needed
+ * @param a Number smaller than P
+ * @param b Number smaller than P
+ * @tparam P Prime (smaller than 2^30)
+ * @return a * b * 2^-32 mod P
+ */
+template<uint32_t P>
+constexpr uint32_t ntt_mul(uint32_t a, uint32_t b) {
+    const uint64_t product = static_cast<uint64_t>(a) * b;
+    const uint32_t m = static_cast<uint32_t>(product) * ntt_montgomery_factor<P>();
+    // product + m * P is divisible by 2^32 and smaller than 2^62, the quotient is smaller than 2 * P
+    const auto res = static_cast<uint32_t>((product + static_cast<uint64_t>(m) * P) >> 32);
+    // res - P wraps around when res < P (no branch, the values are random)
+    return std::min(res, res - P);
+}
+
+/**
+ * Computes the powers of the roots of unity of all levels of the transform (in the Montgomery form)
+ * Root of the level with the half length h is at the index h and its powers follow up to the index 2 * h - 1
+ * @param length Length of the transform (power of two)
+ * @tparam P Prime
+ * @return Powers of the roots of unity
+ */
+template<uint32_t P>
+constexpr std::vector<uint32_t> ntt_roots(size_t length) {
+    std::vector<uint32_t> roots(std::max<size_t>(length, 2));
+    const uint32_t one = (uint64_t{1} << 32) % P;
+    for (size_t half = 1; half < length; half <<= 1) {
+        // Primitive root of unity of the order 2 * half
+        const uint32_t root = (static_cast<uint64_t>(ntt_pow<P>(NTT_ROOT, (P - 1) / (2 * half))) << 32) % P;
+        roots[half] = one;
+        for (size_t j = 1; j < half; j++)
+            roots[half + j] = ntt_mul<P>(roots[half + j - 1], root);
+    }
+    return roots;
+}
+
+/**
+ * Number theoretic transform in place (iterative radix 2 Cooley-Tukey, the length is a power of two)
+ * The inverse transform is the same transform with the values 1 .. n - 1 reversed (and divided by n)
+ * @param values Values modulo P (transformed in place)
+ * @param roots Powers of the roots of unity (see ntt_roots())
+ * @tparam P Prime
+ */
+template<uint32_t P>
+constexpr void ntt(std::vector<uint32_t> &values, const std::vector<uint32_t> &roots) {
+    const size_t n = values.size();
+    // Bit reversal permutation
+    for (size_t i = 1, j = 0; i < n; i++) {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+            std::swap(values[i], values[j]);
+    }
+
+    for (size_t half = 1; half < n; half <<= 1) {
+        const uint32_t *level = roots.data() + half;
+        for (size_t i = 0; i < n; i += 2 * half) {
+            uint32_t *low = values.data() + i, *high = low + half;
+            for (size_t j = 0; j < half; j++) {
+                // Values are smaller than 2^30, so their sum fits into 32 bits (reduced without branches)
+                const uint32_t u = low[j];
+                const uint32_t v = ntt_mul<P>(high[j], level[j]);
+                low[j] = std::min(u + v, u + v - P);
+                high[j] = std::min(u - v, u - v + P);
+            }
+        }
+    }
+}
+
+/**
+ * Cyclic convolution of the digits of two numbers modulo a prime (the product of the polynomials modulo P)
+ * Square (the same operand twice) is transformed only once
+ * @param num1 Number to be multiplied
+ * @param size1 Number of digits of num1
+ * @param num2 Number to be multiplied
+ * @param size2 Number of digits of num2
+ * @param length Length of the transform (power of two, at least size1 + size2 - 1)
+ * @tparam P Prime
+ * @return Coefficients of the product modulo P
+ */
+template<uint32_t P>
+constexpr std::vector<uint32_t> ntt_convolution(const uint32_t *num1, size_t size1, const uint32_t *num2, size_t size2,
+                                      size_t length) {
+    const auto roots = ntt_roots<P>(length);
+    // Montgomery form of 2^32 (the pointwise product drops one 2^32 that is returned by the final scaling)
+    const uint32_t r2 = (static_cast<uint64_t>((uint64_t{1} << 32) % P) << 32) % P;
+
+    std::vector<uint32_t> values1(length, 0);
+    for (size_t i = 0; i < size1; i++)
+        values1[i] = num1[i] % P;
+    ntt<P>(values1, roots);
+
+    if (num1 == num2 && size1 == size2) {
+        for (auto &value : values1)
+            value = ntt_mul<P>(value, value);
+    } else {
+        std::vector<uint32_t> values2(length, 0);
+        for (size_t i = 0; i < size2; i++)
+            values2[i] = num2[i] % P;
+        ntt<P>(values2, roots);
+        for (size_t i = 0; i < length; i++)
+            values1[i] = ntt_mul<P>(values1[i], values2[i]);
+    }
+
+    // Inverse transform, the values are multiplied by 2^32 / n (in the Montgomery form)
+    ntt<P>(values1, roots);
+    std::reverse(values1.begin() + 1, values1.end());
+    const uint32_t scale = ntt_mul<P>(ntt_mul<P>(ntt_pow<P>(length, P - 2), r2), r2);
+    for (auto &value : values1)
+        value = ntt_mul<P>(value, scale);
+    return values1;
+}
+
+/**
+ * Multiplication of two arbitrary precision integers by the number theoretic transform in O(n log n)
+ * The digits are coefficients of polynomials, their product is computed modulo three primes (NTT_PRIMES) and every
+ * coefficient is recombined by the Garner's algorithm: c = a + p1 * (b + p2 * c') with a < p1, b < p2, c' < p3
+ * Every coefficient has at most three digits, they are added to the result with a running carry
+ * It is expected that size1 + size2 is at most NTT_MAX_LENGTH
+ * @param num1 Number to be multiplied
+ * @param size1 Number of digits of num1
+ * @param num2 Number to be multiplied
+ * @param size2 Number of digits of num2
+ * @param result Product with size1 + size2 digits (output)
+ * @tparam Limbs Base of the digits
+ */
+template<LimbBackend Limbs = DecimalLimbs>
+constexpr void mul_limbs_ntt(const uint32_t *num1, size_t size1, const uint32_t *num2, size_t size2, uint32_t *result) {
+    constexpr uint64_t p1 = NTT_PRIMES[0], p2 = NTT_PRIMES[1], p3 = NTT_PRIMES[2];
+    constexpr uint64_t p1_inverse = ntt_pow<p2>(p1, p2 - 2);
+    constexpr uint64_t p1_p2_inverse = ntt_pow<p3>(p1 % p3 * (p2 % p3), p3 - 2);
+
+    const size_t size = size1 + size2;
+    const size_t length = std::bit_ceil(size - 1);
+    const auto residues1 = ntt_convolution<NTT_PRIMES[0]>(num1, size1, num2, size2, length);
+    const auto residues2 = ntt_convolution<NTT_PRIMES[1]>(num1, size1, num2, size2, length);
+    const auto residues3 = ntt_convolution<NTT_PRIMES[2]>(num1, size1, num2, size2, length);
+
+    // Digit k of the result gets the lowest digit of the coefficient k, the middle one of k - 1 and the highest one
+    // of k - 2
+    uint64_t carry = 0, middle = 0, highest = 0, highest_next = 0;
+    for (size_t k = 0; k < size; k++) {
+        uint64_t digit0 = 0, digit1 = 0, digit2 = 0;
+        // Product has size - 1 coefficients
+        if (k + 1 < size) {
+            const uint64_t a = residues1[k];
+            const uint64_t b = (residues2[k] + p2 - a % p2) % p2 * p1_inverse % p2;
+            const uint64_t c = (residues3[k] + p3 - (a + p1 * b) % p3) % p3 * p1_p2_inverse % p3;
+            // b + p2 * c < p2 * p3 < 2^57, the coefficient a + p1 * (b + p2 * c) is split to the digits
+            const uint64_t upper = b + p2 * c;
+            const uint64_t low = a + p1 * (upper % Limbs::BASE);
+            const uint64_t high = p1 * (upper / Limbs::BASE) + low / Limbs::BASE;
+            digit0 = low % Limbs::BASE;
+            digit1 = high % Limbs::BASE;
+            digit2 = high / Limbs::BASE;
+        }
+        uint64_t sum = digit0 + middle + highest + carry;
+        result[k] = sum % Limbs::BASE;
+        carry = sum / Limbs::BASE;
+        middle = digit1;
+        highest = highest_next;
+        highest_next = digit2;
+    }
+}
+
+/**
+ * Returns the size of the scratch buffer mul_limbs() needs for operands with at most size digits
+ * It mirrors the recursion of mul_limbs() and takes the most demanding branch on every level
+ * @param size Number of digits of the bigger operand
+ * @param thresholds Thresholds of the algorithms
+ * @return Number of digits of the scratch buffer
+ */
+constexpr size_t mul_scratch_size(size_t size, const MulThresholds &thresholds) {
+    if (size < thresholds.karatsuba || size < 4)
+        return 0;
+    size_t half = (size + 1) / 2;
+    size_t third = (size + 2) / 3;
+    // Product of one slice of an unbalanced multiplication
+    size_t res = size + 1 + mul_scratch_size(half, thresholds);
+    // Karatsuba sums of halves and their product
+    res = std::max(res, 4 * half + 4 + mul_scratch_size(half + 1, thresholds));
+    // Toom-3 evaluations and three products
+    if (size >= thresholds.toom3)
+        res = std::max(res, 8 * third + 8 + mul_scratch_size(third + 1, thresholds));
+    return res;
+}
+
+/**
+ * Multiplication of two arbitrary precision integers given as digit arrays
+ * Result has always size1 + size2 digits (leading zeros are kept)
+ * Small operands are multiplied by the schoolbook method in O(n * m)
+ * Operands of very different sizes are multiplied by slices of the size of the smaller operand
+ * Bigger operands are split into two halves and multiplied by Karatsuba (three half sized products)
+ * a * b = a1 * b1 * B^2h + ((a0 + a1) * (b0 + b1) - a0 * b0 - a1 * b1) * B^h + a0 * b0
+ * The biggest operands are split into three parts and multiplied by Toom-3 (five third sized products)
+ * The parts are coefficients of polynomials, their product is evaluated at 0, 1, 2, 3 and infinity and interpolated
+ * back, all the points are non-negative, so every intermediate result is non-negative as well (no signs are needed)
+ * The biggest operands are multiplied by the number theoretic transform in O(n log n) (see mul_limbs_ntt()), products
+ * longer than NTT_MAX_LENGTH digits are split by Toom-3 or Karatsuba until the parts fit
+ * Recursion takes all its temporary memory from the scratch buffer (see mul_scratch_size())
+ * @param num1 Number to be multiplied
+ * @param size1 Number of digits of num1
+ * @param num2 Number to be multiplied
+ * @param size2 Number of digits of num2
+ * @param result Product with size1 + size2 digits (output)
+ * @param scratch Scratch buffer
+ * @param thresholds Thresholds of the algorithms
+ * @tparam Limbs Base of the digits
+ */
+template<LimbBackend Limbs = DecimalLimbs>
+constexpr void mul_limbs(const uint32_t *num1, size_t size1, const uint32_t *num2, size_t size2, uint32_t *result,
+               uint32_t *scratch, const MulThresholds &thresholds = Limbs::MUL_THRESHOLDS) {
+    // The first operand is always the bigger one
+    if (size1 < size2) {
+        std::swap(num1, num2);
+        std::swap(size1, size2);
+    }
+    const size_t size = size1 + size2;
+
+    // Schoolbook multiplication
+    if (size2 < thresholds.karatsuba || size2 < 4) {
+        std::fill(result, result + size, 0);
+        for (size_t i = 0; i < size2; i++) {
+            uint64_t carry = 0; // 64 bit carry is needed to prevent overflow
+            for (size_t j = 0; j < size1; j++) {
+                // (2^32 - 1)^2 + 2 * (2^32 - 1) still fits in 64 bits, so this works for the base 2^32 as well
+                uint64_t sum = result[i + j] + static_cast<uint64_t>(num2[i]) * num1[j] + carry;
+                // Carry is the integer part of the sum divided by the base
+                carry = sum / Limbs::BASE;
+                // Sum is the remainder of the sum divided by the base
+                result[i + j] = sum % Limbs::BASE;
+            }
+            // The last carry is always smaller than the base and the digit above is still zero
+            result[i + size1] = carry;
+        }
+        return;
+    }
+
+    // Number theoretic transform (unbalanced operands as well, the transform is as long as the product)
+    if (size2 >= thresholds.ntt && size <= NTT_MAX_LENGTH) {
+        mul_limbs_ntt<Limbs>(num1, size1, num2, size2, result);
+        return;
+    }
+
+    // Unbalanced operands -> multiply slices of the bigger operand by the smaller one
+    if (size2 <= (size1 + 1) / 2) {
+        std::fill(result, result + size, 0);
+        uint32_t *product = scratch;
+        for (size_t offset = 0; offset < size1; offset += size2) {
+            size_t slice = std::min(size2, size1 - offset);
+            mul_limbs<Limbs>(num1 + offset, slice, num2, size2, product, scratch + slice + size2, thresholds);
+            limbs_add_in<Limbs>(result + offset, size - offset, product, slice + size2);
+        }
+        return;
+    }
+
+    // Toom-3
+    if (size2 >= thresholds.toom3) {
+        const size_t k = (size1 + 2) / 3;
+        if (size2 > 2 * k) {
+            // r0 = a0 * b0 and r4 = a2 * b2 are stored right away in their place in the result
+            mul_limbs<Limbs>(num1, k, num2, k, result, scratch, thresholds);
+            mul_limbs<Limbs>(num1 + 2 * k, size1 - 2 * k, num2 + 2 * k, size2 - 2 * k, result + 4 * k, scratch,
+                             thresholds);
+            std::fill(result + 2 * k, result + 4 * k, 0);
+            const uint32_t *r0 = result;
+            const size_t r0_size = limbs_length(result, 2 * k);
+            const uint32_t *r4 = result + 4 * k;
+            const size_t r4_size = limbs_length(result + 4 * k, size - 4 * k);
+
+            // Products of the values at 1, 2 and 3
+            const size_t p_size = 2 * k + 2;
+            uint32_t *eval1 = scratch;
+            uint32_t *eval2 = scratch + k + 1;
+            uint32_t *p[3] = {scratch + 2 * k + 2, scratch + 2 * k + 2 + p_size, scratch + 2 * k + 2 + 2 * p_size};
+            uint32_t *rest = scratch + 2 * k + 2 + 3 * p_size;
+            for (uint32_t x = 1; x <= 3; x++) {
+                limbs_eval_toom3<Limbs>(eval1, num1, size1, k, x);
+                limbs_eval_toom3<Limbs>(eval2, num2, size2, k, x);
+                mul_limbs<Limbs>(eval1, k + 1, eval2, k + 1, p[x - 1], rest, thresholds);
+            }
+
+            // q(x) = (p(x) - r0 - r4 * x^4) / x = r1 + r2 * x + r3 * x^2
+            const uint32_t x4[3] = {1, 16, 81};
+            for (uint32_t x = 1; x <= 3; x++) {
+                limbs_sub_mul_in<Limbs>(p[x - 1], p_size, r0, r0_size);
+                limbs_sub_mul_in<Limbs>(p[x - 1], p_size, r4, r4_size, x4[x - 1]);
+                limbs_div_exact_in<Limbs>(p[x - 1], p_size, x);
+            }
+            // q(3) - q(2) = r2 + 5 * r3, q(2) - q(1) = r2 + 3 * r3
+            limbs_sub_mul_in<Limbs>(p[2], p_size, p[1], p_size);
+            limbs_sub_mul_in<Limbs>(p[1], p_size, p[0], p_size);
+            // r3 = ((r2 + 5 * r3) - (r2 + 3 * r3)) / 2
+            limbs_sub_mul_in<Limbs>(p[2], p_size, p[1], p_size);
+            limbs_div_exact_in<Limbs>(p[2], p_size, 2);
+            // r2 = (r2 + 3 * r3) - 3 * r3
+            limbs_sub_mul_in<Limbs>(p[1], p_size, p[2], p_size, 3);
+            // r1 = q(1) - r2 - r3
+            limbs_sub_mul_in<Limbs>(p[0], p_size, p[1], p_size);
+            limbs_sub_mul_in<Limbs>(p[0], p_size, p[2], p_size);
+
+            // Add r1 * B^k + r2 * B^2k + r3 * B^3k
+            for (size_t i = 0; i < 3; i++)
+                limbs_add_in<Limbs>(result + (i + 1) * k, size - (i + 1) * k, p[i], limbs_length(p[i], p_size));
+            return;
+        }
+    }
+
+    // Karatsuba
+    const size_t h = (size1 + 1) / 2;
+    // z0 = a0 * b0 and z2 = a1 * b1 are stored right away in their place in the result
+    mul_limbs<Limbs>(num1, h, num2, h, result, scratch, thresholds);
+    mul_limbs<Limbs>(num1 + h, size1 - h, num2 + h, size2 - h, result + 2 * h, scratch, thresholds);
+
+    // z1 = (a0 + a1) * (b0 + b1) - z0 - z2
+    uint32_t *sum1 = scratch;
+    uint32_t *sum2 = scratch + h + 1;
+    uint32_t *z1 = scratch + 2 * h + 2;
+    std::copy(num1, num1 + h, sum1);
+    sum1[h] = 0;
+    limbs_add_in<Limbs>(sum1, h + 1, num1 + h, size1 - h);
+    std::copy(num2, num2 + h, sum2);
+    sum2[h] = 0;
+    limbs_add_in<Limbs>(sum2, h + 1, num2 + h, size2 - h);
+    mul_limbs<Limbs>(sum1, limbs_length(sum1, h + 1), sum2, limbs_length(sum2, h + 1), z1, z1 + 2 * h + 2,
+                     thresholds);
+    const size_t z1_size = limbs_length(sum1, h + 1) + limbs_length(sum2, h + 1);
+    limbs_sub_mul_in<Limbs>(z1, z1_size, result, 2 * h);
+    limbs_sub_mul_in<Limbs>(z1, z1_size, result + 2 * h, size - 2 * h);
+    limbs_add_in<Limbs>(result + h, size - h, z1, limbs_length(z1, z1_size));
+}
+
+/**
+ * Multiplication of two arbitrary precision integers
+ * The digits are multiplied by mul_limbs() (schoolbook, Karatsuba, Toom-3 or NTT depending on the sizes)
+ * @param num1 Number to be multiplied
+ * @param num2 Number to be multiplied
+ * @param thresholds Thresholds of the algorithms
+ * @tparam Limbs Base of the digits
+ * @tparam Digits1 Container of the digits of num1 and of the result (std::vector or LimbStorage)
+ * @tparam Digits2 Container of the digits of num2
+ * @return Vector of digits representing the product of num1 and num2
+ */
+template<LimbBackend Limbs = DecimalLimbs, typename Digits1 = std::vector<uint32_t>, typename Digits2 = std::vector<uint32_t>>
+constexpr Digits1 mul(const Digits1 &num1, const Digits2 &num2,
+                      const MulThresholds &thresholds = Limbs::MUL_THRESHOLDS) {
+    Digits1 result_number(num1.size() + num2.size(), 0);
+    // Scratch buffer is empty (no allocation) for the schoolbook multiplication
+    std::vector<uint32_t> scratch(mul_scratch_size(std::max(num1.size(), num2.size()), thresholds));
+    mul_limbs<Limbs>(num1.data(), num1.size(), num2.data(), num2.size(), result_number.data(), scratch.data(),
+                     thresholds);
+
+    // Remove the leading zeros from the result
+    while (result_number.size() > 1 && result_number.back() == 0)
+        result_number.pop_back();
+
+    return result_number;
+}
+
+/**
+ * Division of an arbitrary precision integer by an integer is a bit more complicated than the other operations
+ * We divide the digits from the most significant digit to the least significant digit
+ * If the division of two digits is less than the divisor, we borrow 1 from the next digit
+ * It is expected that the divisor is greater than 0
+ * @param num1 Number to be divided
+ * @param num2 Number to divide by
+ * @tparam Limbs Base of the digits
+ * @tparam Digits Container of the digits of num1 and of the result (std::vector or LimbStorage)
+ * @return Vector of digits representing the quotient of num1 and num2
+ */
+template<LimbBackend Limbs = DecimalLimbs, typename Digits = std::vector<uint32_t>>
+constexpr Digits div(const Digits &num1, const uint32_t num2) {
+    Digits result_number;
+
+    uint64_t carry = 0;
+    for (int32_t i = static_cast<int32_t>(num1.size()) - 1; i >= 0; i--) {
+        // Since the num1 is always greater than num2, we can assume that num1 has a digit at index i (always)
+        uint64_t sum = num1[i] + carry * Limbs::BASE;
+        // Result is the integer part of the sum divided by the divisor
+        result_number.push_back(sum / num2);
+        // Carry is the remainder of the sum divided by the divisor
+        carry = sum % num2;
+    }
+
+    // Reverse the result
+    std::reverse(result_number.begin(), result_number.end());
+
+    // Remove the leading zeros from the result
+    while (result_number.size() > 1 && result_number.back() == 0)
+        result_number.pop_back();
+
+    return result_number;
+}
+
+/**
+ * Comparison of two arbitrary precision integers (vectors of digits without leading zeros)
+ * Longer number is bigger, numbers of the same length are compared from the most significant digit
+ * Digits are compared as numbers, so this works for any base
+ * @param num1 Number to be compared
+ * @param num2 Number to be compared
+ * @tparam Digits1 Container of the digits of num1 (std::vector, LimbStorage or std::span)
+ * @tparam Digits2 Container of the digits of num2
+ * @return Negative number if num1 < num2, zero if num1 == num2, positive number if num1 > num2
+ */
+template<typename Digits1, typename Digits2>
+constexpr int32_t compare(const Digits1 &num1, const Digits2 &num2) {
+    if (num1.size() != num2.size())
+        return num1.size() < num2.size() ? -1 : 1;
+    for (auto i = static_cast<int32_t>(num1.size()) - 1; i >= 0; i--) {
+        if (num1[i] != num2[i])
+            return num1[i] < num2[i] ? -1 : 1;
+    }
+    return 0;
+}
+
+/**
+ * Division of an arbitrary precision integer by an integer, only the remainder is computed
+ * It is expected that the divisor is greater than 0
+ * @param num1 Number to be divided
+ * @param num2 Number to divide by
+ * @tparam Limbs Base of the digits
+ * @tparam Digits Container of the digits of num1
+ * @return Remainder of num1 divided by num2
+ */
+template<LimbBackend Limbs = DecimalLimbs, typename Digits = std::vector<uint32_t>>
+constexpr uint32_t mod(const Digits &num1, const uint32_t num2) {
+    uint64_t carry = 0;
+    for (int32_t i = static_cast<int32_t>(num1.size()) - 1; i >= 0; i--)
+        carry = (num1[i] + carry * Limbs::BASE) % num2;
+    return carry;
+}
+
+/**
+ * Division of two arbitrary precision integers is the most complex operation of them all
+ * This is the schoolbook long division (Knuth, TAOCP Vol. 2, 4.3.1, Algorithm D)
+ * Both numbers are first normalized (multiplied by d), so the most significant digit of the divisor is at least
+ * half of the base - then the quotient digit estimated from the top two digits of the dividend and the top digit of
+ * the divisor is at most 2 too big, the top two digits of the divisor make it at most 1 too big
+ * Every quotient digit is then multiplied by the divisor and subtracted from the dividend, if the dividend
+ * underflows, the divisor is added back once and the quotient digit is decreased
+ * The remainder is what is left of the dividend divided by d (de-normalized)
+ * It is expected that the divisor is greater than 0 and has no leading zeros
+ * @param num1 Number to be divided
+ * @param num2 Number to divide by
+ * @param quotient Quotient of num1 and num2 (output), nullptr if not needed
+ * @param remainder Remainder of num1 divided by num2 (output), nullptr if not needed
+ * @tparam Limbs Base of the digits
+ * @tparam Digits1 Container of the digits of num1 and of the results (std::vector or LimbStorage)
+ * @tparam Digits2 Container of the digits of num2
+ */
+template<LimbBackend Limbs = DecimalLimbs, typename Digits1 = std::vector<uint32_t>, typename Digits2 = std::vector<uint32_t>>
+constexpr void divmod(const Digits1 &num1, const Digits2 &num2, std::type_identity_t<Digits1> *quotient,
+            std::type_identity_t<Digits1> *remainder) {
+    constexpr uint64_t base = Limbs::BASE;
+
+    // Dividend is smaller than the divisor -> quotient is zero and the dividend is the remainder
+    if (compare(num1, num2) < 0) {
+        if (quotient)
+            *quotient = {0};
+        if (remainder)
+            *remainder = num1;
+        return;
+    }
+
+    // Divisor with only one digit -> small division
+    if (num2.size() == 1) {
+        if (quotient)
+            *quotient = div<Limbs>(num1, num2[0]);
+        if (remainder)
+            *remainder = {mod<Limbs>(num1, num2[0])};
+        return;
+    }
+
+    const size_t n = num2.size();
+    const size_t m = num1.size() - n;
+
+    // Normalization factor (power of two for the binary base, so it is just a shift)
+    uint32_t d;
+    if constexpr (Limbs::BINARY)
+        d = 1u << std::countl_zero(num2.back());
+    else
+        d = base / (static_cast<uint64_t>(num2.back()) + 1);
+
+    // Normalized dividend always gets one more digit, normalized divisor never does
+    std::vector<uint32_t> u(num1.size() + 1, 0);
+    std::vector<uint32_t> v(n, 0);
+    uint64_t carry = 0;
+    for (size_t i = 0; i < num1.size(); i++) {
+        uint64_t sum = static_cast<uint64_t>(num1[i]) * d + carry;
+        carry = sum / base;
+        u[i] = sum % base;
+    }
+    u[num1.size()] = carry;
+    carry = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t sum = static_cast<uint64_t>(num2[i]) * d + carry;
+        carry = sum / base;
+        v[i] = sum % base;
+    }
+
+    if (quotient)
+        quotient->assign(m + 1, 0);
+
+    for (auto j = static_cast<int64_t>(m); j >= 0; j--) {
+        // Estimate the quotient digit from the top two digits of the dividend and the top digit of the divisor
+        uint64_t top = u[j + n] * base + u[j + n - 1];
+        uint64_t q_hat = top / v[n - 1];
+        uint64_t r_hat = top % v[n - 1];
+        // Correct the estimate with the second digit of the divisor
+        while (q_hat >= base || q_hat * v[n - 2] > r_hat * base + u[j + n - 2]) {
+            q_hat--;
+            r_hat += v[n - 1];
+            if (r_hat >= base)
+                break;
+        }
+
+        // Multiply and subtract q_hat * divisor from the current part of the dividend
+        int64_t borrow = 0;
+        carry = 0;
+        for (size_t i = 0; i < n; i++) {
+            uint64_t product = q_hat * v[i] + carry;
+            carry = product / base;
+            auto diff = static_cast<int64_t>(u[i + j]) - static_cast<int64_t>(product % base) - borrow;
+            borrow = diff < 0;
+            u[i + j] = diff + borrow * static_cast<int64_t>(base);
+        }
+        auto diff = static_cast<int64_t>(u[j + n]) - static_cast<int64_t>(carry) - borrow;
+        borrow = diff < 0;
+        u[j + n] = diff + borrow * static_cast<int64_t>(base);
+
+        // The estimate was still one too big (rare) -> add the divisor back
+        if (borrow) {
+            q_hat--;
+            carry = 0;
+            for (size_t i = 0; i < n; i++) {
+                uint64_t sum = static_cast<uint64_t>(u[i + j]) + v[i] + carry;
+                carry = sum / base;
+                u[i + j] = sum % base;
+            }
+            u[j + n] = (u[j + n] + carry) % base; // Carry out of the top digit cancels the borrow
+        }
+
+        if (quotient)
+            (*quotient)[j] = q_hat;
+    }
+
+    if (quotient) {
+        // Remove the leading zeros from the quotient
+        while (quotient->size() > 1 && quotient->back() == 0)
+            quotient->pop_back();
+    }
+
+    if (remainder) {
+        // De-normalize the remainder (the lowest n digits of what is left of the dividend)
+        u.resize(n);
+        while (u.size() > 1 && u.back() == 0)
+            u.pop_back();
+        *remainder = div<Limbs>(u, d);
+    }
+}
+
+/**
+ * Division of two arbitrary precision integers, only the quotient is computed (see divmod())
+ * @param num1 Number to be divided
+ * @param num2 Number to divide by
+ * @tparam Limbs Base of the digits
+ * @tparam Digits1 Container of the digits of num1 and of the result (std::vector or LimbStorage)
+ * @tparam Digits2 Container of the digits of num2
+ * @return Vector of digits representing the quotient of num1 and num2
+ */
+template<LimbBackend Limbs = DecimalLimbs, typename Digits1 = std::vector<uint32_t>, typename Digits2 = std::vector<uint32_t>>
+constexpr Digits1 div(const Digits1 &num1, const Digits2 &num2) {
+    Digits1 quotient;
+    divmod<Limbs>(num1, num2, &quotient, nullptr);
+    return quotient;
+}
+
+/**
+ * Division of two arbitrary precision integers, only the remainder is computed (see divmod())
+ * @param num1 Number to be divided
+ * @param num2 Number to divide by
+ * @tparam Limbs Base of the digits
+ * @tparam Digits1 Container of the digits of num1 and of the result (std::vector or LimbStorage)
+ * @tparam Digits2 Container of the digits of num2
+ * @return Vector of digits representing the remainder of num1 divided by num2
+ */
+template<LimbBackend Limbs = DecimalLimbs, typename Digits1 = std::vector<uint32_t>, typename Digits2 = std::vector<uint32_t>>
+constexpr Digits1 mod(const Digits1 &num1, const Digits2 &num2) {
+    Digits1 remainder;
+    divmod<Limbs>(num1, num2, nullptr, &remainder);
+    return remainder;
+}
+
+/**
+ * Multiplies an arbitrary precision integer by a small number and adds another small number to it (in place)
+ * This is one step of the Horner scheme used for the conversions between bases
+ * @param num Number to be multiplied (result is stored here)
+ * @param multiplier Small number to multiply by (smaller than the base)
+ * @param addend Small number to add (smaller than the base)
+ * @tparam Limbs Base of the digits
+ * @tparam Digits Container of the digits (std::vector or LimbStorage)
+ */
+template<LimbBackend Limbs = DecimalLimbs, typename Digits = std::vector<uint32_t>>
+constexpr void mul_add_small(Digits &num, uint32_t multiplier, uint32_t addend) {
+    uint64_t carry = addend;
+    for (auto &digit: num) {
+        uint64_t sum = static_cast<uint64_t>(digit) * multiplier + carry;
+        carry = sum / Limbs::BASE;
+        digit = sum % Limbs::BASE;
+    }
+    if (carry)
+        num.push_back(carry);
+    // Remove the leading zeros (number was zero and nothing was added)
+    while (num.size() > 1 && num.back() == 0)
+        num.pop_back();
+}
+
+/**
+ * Number of factors up to which a range is multiplied directly (leaf of the product tree, see range_product())
+ */
+constexpr uint64_t PRODUCT_LEAF_SIZE = 32;
+
+/**
+ * Product of all the numbers in the range [first, last] by binary splitting (product tree)
+ * The range is split into two halves whose products have similar sizes, so the fast multiplications (Karatsuba,
+ * Toom-3, NTT) always get balanced operands, instead of a huge number multiplied by a small one in every step
+ * Leaves multiply the numbers into one digit as long as the product is smaller than the base
+ * Upper levels of the tree are computed by two threads (the left half in a new thread), every level doubles
+ * the number of threads
+ * @param first First number of the range (at least 1)
+ * @param last Last number of the range (at least first)
+ * @param parallel_depth Number of levels of the tree whose halves are computed in parallel
+ * @tparam Limbs Base of the digits
+ * @return Digits of the product
+ */
+template<LimbBackend Limbs = DecimalLimbs>
+std::vector<uint32_t> range_product(uint64_t first, uint64_t last, int parallel_depth) {
+    if (last - first < PRODUCT_LEAF_SIZE) {
+        std::vector<uint32_t> res{1};
+        uint64_t small = 1;
+        for (uint64_t i = first; i <= last; i++) {
+            if (i >= Limbs::BASE) {
+                // Number with two digits (only for ranges far beyond any practical factorial)
+                res = mul<Limbs>(res, std::vector<uint32_t>{static_cast<uint32_t>(i % Limbs::BASE),
+                                                            static_cast<uint32_t>(i / Limbs::BASE)});
+                continue;
+            }
+            if (small * i >= Limbs::BASE) {
+                mul_add_small<Limbs>(res, small, 0);
+                small = 1;
+            }
+            small *= i;
+        }
+        mul_add_small<Limbs>(res, small, 0);
+        return res;
+    }
+
+    const uint64_t middle = first + (last - first) / 2;
+    if (parallel_depth <= 0)
+        return mul<Limbs>(range_product<Limbs>(first, middle, 0), range_product<Limbs>(middle + 1, last, 0));
+
+    std::vector<uint32_t> left;
+    std::thread worker([&left, first, middle, parallel_depth] {
+        left = range_product<Limbs>(first, middle, parallel_depth - 1);
+    });
+    auto right = range_product<Limbs>(middle + 1, last, parallel_depth - 1);
+    worker.join();
+    return mul<Limbs>(left, right);
+}
+
+/**
+ * Number of source digits up to which the base is converted by the Horner scheme (see convert_base())
+ */
+constexpr size_t CONVERT_THRESHOLD = 64;
+
+/**
+ * Converts digits of an arbitrary precision integer from one base to another (Horner scheme)
+ * Digits of the source are processed from the most significant one, the base 2^32 is split into two halves,
+ * so every multiplier fits into one digit of the target base
+ * @param num Digits of the number in the source base
+ * @param size Number of digits
+ * @tparam From Source base
+ * @tparam To Target base
+ * @return Number in the target base
+ */
+template<LimbBackend From, LimbBackend To>
+constexpr std::vector<uint32_t> convert_base_horner(const uint32_t *num, size_t size) {
+    std::vector<uint32_t> result_number{0};
+    for (auto i = static_cast<int64_t>(size) - 1; i >= 0; i--) {
+        if constexpr (From::BASE > UINT32_MAX) {
+            mul_add_small<To>(result_number, 1u << 16, num[i] >> 16);
+            mul_add_small<To>(result_number, 1u << 16, num[i] & 0xFFFF);
+        } else {
+            mul_add_small<To>(result_number, From::BASE, num[i]);
+        }
+    }
+    return result_number;
+}
+
+/**
+ * Computes From::BASE^CONVERT_THRESHOLD in the target base (the lowest power of the divide and conquer conversion)
+ * @tparam From Source base
+ * @tparam To Target base
+ * @return Digits of the power
+ */
+template<LimbBackend From, LimbBackend To>
+constexpr std::vector<uint32_t> convert_base_first_power() {
+    std::vector<uint32_t> power(CONVERT_THRESHOLD + 1, 0);
+    power.back() = 1;
+    return convert_base_horner<From, To>(power.data(), power.size());
+}
+
+/**
+ * From::BASE^CONVERT_THRESHOLD in the target base, generated at compile time (read-only data, no work at runtime)
+ * @tparam From Source base
+ * @tparam To Target base
+ */
+template<LimbBackend From, LimbBackend To>
+constexpr auto CONVERT_FIRST_POWER = [] {
+    std::array<uint32_t, convert_base_first_power<From, To>().size()> res{};
+    const auto power = convert_base_first_power<From, To>();
+    std::copy(power.begin(), power.end(), res.begin());
+    return res;
+}();
+
+/**
+ * Converts digits of an arbitrary precision integer from one base to another (divide and conquer)
+ * Number is split to the lower part with CONVERT_THRESHOLD * 2^level digits and the upper part, both are converted
+ * recursively and joined as upper * From::BASE^(CONVERT_THRESHOLD * 2^level) + lower in the target base
+ * @param num Digits of the number in the source base
+ * @param size Number of digits
+ * @param powers Powers From::BASE^(CONVERT_THRESHOLD * 2^level) in the target base (computed when first needed, the
+ *               first one is CONVERT_FIRST_POWER)
+ * @tparam From Source base
+ * @tparam To Target base
+ * @return Number in the target base
+ */
+template<LimbBackend From, LimbBackend To>
+constexpr std::vector<uint32_t> convert_base_recursive(const uint32_t *num, size_t size,
+                                                       std::vector<std::vector<uint32_t>> &powers) {
+    if (size <= CONVERT_THRESHOLD)
+        return convert_base_horner<From, To>(num, size);
+
+    size_t level = 0;
+    size_t lower_size = CONVERT_THRESHOLD;
+    while (2 * lower_size < size) {
+        lower_size *= 2;
+        level++;
+    }
+    while (powers.size() <= level) {
+        if (powers.empty()) {
+            powers.emplace_back(CONVERT_FIRST_POWER<From, To>.begin(), CONVERT_FIRST_POWER<From, To>.end());
+        } else {
+            powers.push_back(mul<To>(powers.back(), powers.back()));
+        }
+    }
+
+    auto result_number = mul<To>(convert_base_recursive<From, To>(num + lower_size, size - lower_size, powers),
+                                 powers[level]);
+    add_in_place<To>(result_number, convert_base_recursive<From, To>(num, lower_size, powers));
+    return result_number;
+}
+
+/**
+ * Converts digits of an arbitrary precision integer from one base to another
+ * Small numbers are converted by the Horner scheme (quadratic), bigger ones by divide and conquer, which only
+ * multiplies in the target base (as fast as the multiplication, see mul_limbs())
+ * @param num Number in the source base
+ * @tparam From Source base
+ * @tparam To Target base
+ * @tparam Digits Container of the digits of the source (std::vector or LimbStorage)
+ * @return Number in the target base
+ */
+template<LimbBackend From, LimbBackend To, typename Digits = std::vector<uint32_t>>
+constexpr std::vector<uint32_t> convert_base(const Digits &num) {
+    if constexpr (From::BASE == To::BASE) {
+        return {num.begin(), num.end()};
+    } else {
+        // Powers are shared by the whole conversion
+        std::vector<std::vector<uint32_t>> powers;
+        auto result_number = convert_base_recursive<From, To>(num.data(), num.size(), powers);
+        while (result_number.size() > 1 && result_number.back() == 0)
+            result_number.pop_back();
+        return result_number;
+    }
+}
+
+/**
+ * Class representing an overflow exception
+ * This exception is thrown when an operation results in an overflow
+ * The operation is not performed and the result is not stored
+ */
+class MyOverflowException : public std::exception {
+private:
+    /** Message to be displayed when the exception is thrown */
+    char *message;
+
+public:
+    /**
+     * Constructor for the MyOverflowException class
+     * @param msg Message to be displayed when the exception is thrown
+     */
+    explicit MyOverflowException(const std::string &msg) {
+        const char *c_msg = msg.c_str();
+        message = new char[strlen(c_msg) + 1];
+        strcpy(message, c_msg);
+    }
+
+    /**
+     * Destructor for the MyOverflowException class
+     * Deletes the message
+     */
+    ~MyOverflowException() override {
+        delete[] message;
+    }
+
+    /**
+     * Returns the message of the exception
+     * @return Message of the exception
+     */
+    char *what() {
+        return message;
+    }
+};
+
+/**
+ * Class representing Arbitrary Precision Integers
+ * This class is used to store arbitrarily large integers
+ * The integers are stored as a vector of digits in base 1 000 000 000
+ * The base is chosen to be 1 000 000 000 because it is the largest power of 10 that fits in 32 bits
+ * The base is chosen to be 1 000 000 000 because it is the largest power of 10 which can be multiplied by itself
+ * without overflowing a 64 bit integer
+ * The base can be switched to 2^32 with the BinaryLimbs backend (bit operations are then native shifts and masks,
+ * decimal conversion happens only in the string constructor and toString())
+ * Digits are stored inline (LimbStorage), bounded instances have room for all their digits, unlimited ones for 512 bits
+ * @tparam max_digits Maximum number of digits in the integer (excluding the sign) (UNLIMITED is possible)
+ * @tparam Limbs Base of the digits (DecimalLimbs or BinaryLimbs)
+ */
+template<ValidDigit T, T max_digits, LimbBackend Limbs = DecimalLimbs>
+class MPInt {
+public:
+    /**
+     * Number of digits stored inline - all digits of a bounded number (one more for the carry of a temporary result),
+     * SMALL_BUFFER_DIGITS for an unlimited one
+     * (every decimal digit is log2(10) ~ 3.322 bits, binary digit has 32 bits, decimal one 9 decimal digits)
+     */
+    static constexpr size_t INLINE_DIGITS = max_digits == UNLIMITED ? SMALL_BUFFER_DIGITS :
+                                            (Limbs::BINARY ? (static_cast<size_t>(max_digits) * 3322 / 1000 + 31) / 32
+                                                           : (static_cast<size_t>(max_digits) + MAX_DIGITS - 1) /
+                                                             MAX_DIGITS) + 1;
+    /** Storage of the digits */
+    using Storage = LimbStorage<INLINE_DIGITS>;
+
+private:
+    /** Digits representing the integer */
+    Storage mNumber;
+    /** Sign of the integer (either +1 or -1) */
+    int32_t mSign;
+
+    /**
+     * Counts the decimal digits of the absolute value of the number (without the string of the whole number)
+     * @return Number of decimal digits
+     */
+    [[nodiscard]] constexpr uint64_t decimalLength() const {
+        auto decimal = convert_base<Limbs, DecimalLimbs>(mNumber);
+        uint64_t length = (decimal.size() - 1) * MAX_DIGITS + 1;
+        for (uint32_t top = decimal.back(); top >= 10; top /= 10)
+            length++;
+        return length;
+    }
+
+    /**
+     * Function to check if the number isn't too large for the given number of digits
+     * If the number is too large, an overflow exception is thrown
+     * The check needs no strings, so it can be evaluated at compile time as well (the overflow is then a compile error)
+     */
+    constexpr void checkLengthOfDigits() const {
+        // If the maximum number of digits is unlimited, we don't need to check the length of the number
+        if (max_digits == UNLIMITED)
+            return;
+
+        // Quick estimate first, the exact decimal length is counted only if the number can be too big
+        // (every bit adds log10(2) ~ 0.30103 decimal digits, every decimal digit has MAX_DIGITS of them)
+        if constexpr (Limbs::BINARY) {
+            if (bitLength() * 30103 / 100000 + 1 <= static_cast<uint64_t>(max_digits))
+                return;
+        } else {
+            if (mNumber.size() * MAX_DIGITS <= static_cast<uint64_t>(max_digits))
+                return;
+        }
+        if (decimalLength() > static_cast<uint64_t>(max_digits))
+            throw MyOverflowException(
+                    "Number " + toString() + " is too big for " + std::to_string(max_digits) + " digits"
+            );
+    }
+
+    /**
+     * Function to create a factorial of a number
+     * Factorial is the product of all the numbers from 1 to the number, computed by the product tree (see
+     * range_product()) whose upper levels are spread over all available threads
+     * @return Factorial of the number
+     */
+    [[nodiscard]] MPInt factorial() const {
+        uint64_t n = 0;
+        for (size_t i = mNumber.size(); i-- > 0;)
+            n = n * Limbs::BASE + mNumber[i];
+
+        // Every level of the tree doubles the number of threads
+        const unsigned thread_count = std::max(1u, std::thread::hardware_concurrency());
+        const int parallel_depth = std::bit_width(thread_count - 1);
+        auto digits = range_product<Limbs>(1, n, parallel_depth);
+        // Check of the maximum number of digits is done by the constructor
+        return {Storage(digits), 1};
+    }
+
+    /**
+     * Writes one decimal digit (base 10^9) with its leading zeros
+     * @param digit Digit
+     * @param output Output characters (MAX_DIGITS of them are written)
+     */
+    static void formatDigit(uint32_t digit, char *output) {
+        for (int32_t i = MAX_DIGITS - 1; i >= 0; i--) {
+            output[i] = static_cast<char>('0' + digit % 10);
+            digit /= 10;
+        }
+    }
+
+    /**
+     * Adds a number given by its digits and sign to this number in place
+     * Digits of this number are reused (see add_in_place(), sub_in_place() and sub_reverse_in_place())
+     * The number of digits is not checked here
+     * @param digits Digits of the other number (can be the digits of this number)
+     * @param sign Sign of the other number
+     * @tparam Digits Container of the digits
+     */
+    template<typename Digits>
+    constexpr void addInPlace(const Digits &digits, int32_t sign) {
+        // +x + +y OR -x + -y -> Addition (with the same sign)
+        if (mSign == sign)
+            add_in_place<Limbs>(mNumber, digits);
+            // +x + -y OR -x + +y -> The smaller absolute value is subtracted from the bigger one
+        else if (compare(mNumber, digits) >= 0)
+            sub_in_place<Limbs>(mNumber, digits);
+        else {
+            sub_reverse_in_place<Limbs>(mNumber, digits);
+            mSign = sign;
+        }
+
+        // To avoid negative zero
+        if (isZero())
+            mSign = 1;
+    }
+
+public:
+    constexpr MPInt() : mNumber(1, 0), mSign(1) {
+        // Nothing to do here :)
+    }
+
+    /**
+     * Constructor for the MPInt class based on a given string
+     * @param num Number as a string (can be negative)
+     */
+    explicit MPInt(const std::string &num) : mNumber(), mSign(1) {
+        std::string_view num_view = num;
+
+        // If the number is negative, set the sign to -1 and remove the negative sign from the number
+        if (num_view[0] == '-') {
+            mSign = -1;
+            num_view.remove_prefix(1);
+        }
+
+        // Remove non-leading zeros from the number
+        auto first_digit = num_view.find_first_not_of('0');
+        num_view.remove_prefix(std::min(first_digit, num_view.length() - 1));
+
+        // Go through the number from the least significant digit to the most significant digit
+        mNumber.reserve(num_view.length() / MAX_DIGITS + 1);
+        for (auto i = static_cast<int64_t>(num_view.length()); i > 0; i -= MAX_DIGITS) {
+            if (i < MAX_DIGITS)
+                mNumber.push_back(std::stoi(std::string(num_view.substr(0, i))));
+            else
+                mNumber.push_back(std::stoi(std::string(num_view.substr(i - MAX_DIGITS, MAX_DIGITS))));
+        }
+
+        // Decimal digits are converted to the binary ones right away
+        if constexpr (Limbs::BINARY)
+            mNumber = convert_base<DecimalLimbs, Limbs>(mNumber);
+
+        // Check if the number is too large for the given number of digits
+        checkLengthOfDigits();
+    }
+
+    /**
+     * Constructor for the MPInt class based on given digits and a sign
+     * @param num Number as digits (std::vector or LimbStorage are converted)
+     * @param sign Sign of the number (either +1 or -1)
+     */
+    constexpr MPInt(Storage num, int32_t sign) : mNumber(std::move(num)), mSign(sign) {
+        // Check if the number is too large for the given number of digits
+        checkLengthOfDigits();
+    }
+
+    /**
+     * Constructor for the MPInt class based on a given integer (no decimal string conversion is needed)
+     * @param num Number (can be negative)
+     */
+    explicit constexpr MPInt(int64_t num) : mNumber(), mSign(num < 0 ? -1 : 1) {
+        // Magnitude of INT64_MIN doesn't fit into int64_t, compute it in unsigned
+        uint64_t magnitude = num < 0 ? 0 - static_cast<uint64_t>(num) : static_cast<uint64_t>(num);
+        do {
+            mNumber.push_back(magnitude % Limbs::BASE);
+            magnitude /= Limbs::BASE;
+        } while (magnitude);
+
+        // Check if the number is too large for the given number of digits
+        checkLengthOfDigits();
+    }
+
+    /**
+     * Copy constructor for the MPInt class based on another MPInt instance of the same type
+     * @param other MPInt instance to copy
+     */
+    constexpr MPInt(const MPInt &other) noexcept: mNumber(other.mNumber), mSign(other.mSign) {
+        // Nothing to do here :)
+    }
+
+    /**
+     * Move constructor for the MPInt class based on another MPInt instance of the same type
+     * @param other MPInt instance to move
+     */
+    constexpr MPInt(MPInt &&other) noexcept: mNumber(std::move(other.mNumber)), mSign(other.mSign) {
+        // Take away everything from the other instance
+        other.mNumber = {};
+        other.mSign = 0;
+    }
+
+    /**
+     * Default destructor for the MPInt class
+     */
+    ~MPInt() = default;
+
+    /**
+     * Copy assignment operator for the MPInt class based on another MPInt instance of the same type
+     * @param other MPInt instance to copy
+     * @return MPInt instance with the same value as the other instance
+     */
+    constexpr MPInt &operator=(const MPInt &other) noexcept {
+        mNumber = other.mNumber;
+        mSign = other.mSign;
+        return *this;
+    }
+
+    /**
+     * Move assignment operator for the MPInt class based on another MPInt instance of the same type
+     * @param other MPInt instance to move
+     * @return MPInt instance with the same value as the other instance
+     */
+    constexpr MPInt &operator=(MPInt &&other) noexcept {
+        mNumber = std::move(other.mNumber);
+        mSign = other.mSign;
+        // Take away everything from the other instance
+        other.mNumber = {};
+        other.mSign = 0;
+        return *this;
+    }
+
+    /**
+     * Overloaded operator + for addition of two MPInt instances
+     * Addition of two MPInts with the same sign is done by adding the digits of the numbers and carrying over the sign
+     * Addition of two MPInts with different signs is done by subtracting the other number from this number, but
+     * the sign of the other number needs to be swapped
+     * +x + +y is x + y
+     * -x + -y is -(x + y)
+     * +x + -y is x - y
+     * -x + +y is -(x - y)
+     * @tparam max_digits_other Maximum number of digits in the other MPInt instance
+     * @param other Other MPInt instance
+     * @return Sum of the two MPInt instances with the same number of digits as the maximum number of digits of the two
+     */
+    template<T max_digits_other>
+    constexpr MPInt<T, MaxDigits<max_digits, max_digits_other>::value, Limbs> operator+(const MPInt<T, max_digits_other, Limbs> &other) const & {
+        // +x + +y OR -x + -y -> Addition (with the same sign)
+        if (mSign == other.getSign())
+            return {add<Limbs>(mNumber, other.getNumber()), mSign};
+            // +x + -y OR -x + +y -> Subtraction (but swap sign of the second operand)
+        else {
+            MPInt<T, max_digits_other, Limbs> tmp{other.getNumber(), -other.getSign()};
+            return *this - tmp;
+        }
+    }
+
+    /**
+     * Overloaded operator + for addition of two MPInt instances, where this instance is a temporary
+     * Digits of this instance are reused for the result (if the result has the same type)
+     * @tparam max_digits_other Maximum number of digits in the other MPInt instance
+     * @param other Other MPInt instance
+     * @return Sum of the two MPInt instances with the same number of digits as the maximum number of digits of the two
+     */
+    template<T max_digits_other>
+    constexpr MPInt<T, MaxDigits<max_digits, max_digits_other>::value, Limbs> operator+(const MPInt<T, max_digits_other, Limbs> &other) && {
+        if constexpr (MaxDigits<max_digits, max_digits_other>::value == max_digits) {
+            *this += other;
+            return std::move(*this);
+        } else {
+            return static_cast<const MPInt &>(*this) + other;
+        }
+    }
+
+    /**
+     * Overloaded operator += for addition of two MPInt instances
+     * Unlimited numbers are added in place (the capacity of the digits is reused), bounded numbers are added in
+     * a copy, which is stored only if it fits (see MyOverflowException)
+     * @tparam max_digits_other Maximum number of digits in the other MPInt instance
+     * @param other Other MPInt instance
+     * @return This MPInt instance
+     */
+    template<T max_digits_other>
+    constexpr MPInt &operator+=(const MPInt<T, max_digits_other, Limbs> &other) {
+        // Check if the number is too large for the given number of digits
+        if (MaxDigits<max_digits, max_digits_other>::value != max_digits)
+            throw MyOverflowException(
+                    "Number " + (*this + other).toString() + " is too big for " + std::to_string(max_digits) +
+                    " digits");
+        if constexpr (max_digits == UNLIMITED) {
+            addInPlace(other.getNumber(), other.getSign());
+        } else {
+            auto result = *this;
+            result.addInPlace(other.getNumber(), other.getSign());
+            result.checkLengthOfDigits();
+            *this = std::move(result);
+        }
+        return *this;
+    }
+
+    /**
+     * Overloaded operator - for subtraction of two MPInt instances,
+     * Subtraction of two MPInts is done by subtracting the bigger number from the smaller number and carrying over the
+     * right sign (this > other -> this.sign || this < other -> -this.sign)
+     * This works only if the two MPInts had the same sign to begin with
+     * Subtraction of two MPInts with different signs is done by adding the numbers, but the sign of the other number
+     * needs to be swapped
+     * +x - +y is x - y
+     * -x - -y is -(x - y)
+     * +x - -y is x + y
+     * -x - +y is -(x + y)
+     * @tparam max_digits_other Maximum number of digits in the other MPInt instance
+     * @param other Other MPInt instance
+     * @return Difference of the two MPInt instances with the same number of digits as the maximum number of digits of
+     *         the two
+     */
+    template<T max_digits_other>
+    constexpr MPInt<T, MaxDigits<max_digits, max_digits_other>::value, Limbs> operator-(const MPInt<T, max_digits_other, Limbs> &other) const & {
+        // Check if the two numbers are the same with different signs
+        if (mNumber == other.getNumber() && mSign == other.getSign())
+            return {{0}, 1}; // To avoid negative zero
+
+        if (isZero())
+            return {other.getNumber(), -1 * other.getSign()};
+        if (other.isZero())
+            return {mNumber, mSign};
+
+        // +x - +y OR -x - -y -> Subtraction (with the same sign)
+        // The smaller absolute value is always subtracted from the bigger one
+        if (mSign == other.getSign()) {
+            if (compare(mNumber, other.getNumber()) > 0)
+                return {sub<Limbs>(mNumber, other.getNumber()), mSign};
+            else
+                return {sub<Limbs>(other.getNumber(), mNumber), -mSign};
+        }
+            // +x - -y OR -x - +y -> Addition (but swap sign of the second operand)
+        else {
+            MPInt<T, max_digits_other, Limbs> tmp{other.getNumber(), -other.getSign()};
+            return *this + tmp;
+        }
+    }
+
+    /**
+     * Overloaded operator - for subtraction of two MPInt instances, where this instance is a temporary
+     * Digits of this instance are reused for the result (if the result has the same type)
+     * @tparam max_digits_other Maximum number of digits in the other MPInt instance
+     * @param other Other MPInt instance
+     * @return Difference of the two MPInt instances with the same number of digits as the maximum number of digits of
+     *         the two
+     */
+    template<T max_digits_other>
+    constexpr MPInt<T, MaxDigits<max_digits, max_digits_other>::value, Limbs> operator-(const MPInt<T, max_digits_other, Limbs> &other) && {
+        if constexpr (MaxDigits<max_digits, max_digits_other>::value == max_digits) {
+            *this -= other;
+            return std::move(*this);
+        } else {
+            return static_cast<const MPInt &>(*this) - other;
+        }
+    }
+
+    /**
+     * Overloaded operator -= for subtraction of two MPInt instances
+     * Unlimited numbers are subtracted in place (the capacity of the digits is reused), bounded numbers are subtracted
+     * in a copy, which is stored only if it fits (see MyOverflowException)
+     * @tparam max_digits_other Maximum number of digits in the other MPInt instance
+     * @param other Other MPInt instance
+     * @return This MPInt instance
+     */
+    template<T max_digits_other>
+    constexpr MPInt &operator-=(const MPInt<T, max_digits_other, Limbs> &other) {
+        // Check if the number is too large for the given number of digits
+        if (MaxDigits<max_digits, max_digits_other>::value != max_digits)
+            throw MyOverflowException(
+                    "Number " + (*this - other).toString() + " is too big for " + std::to_string(max_digits) +
+                    " digits");
+        if constexpr (max_digits == UNLIMITED) {
+            addInPlace(other.getNumber(), -other.getSign());
+        } else {
+            auto result = *this;
+            result.addInPlace(other.getNumber(), -other.getSign());
+            result.checkLengthOfDigits();
+            *this = std::move(result);
+        }
+        return *this;
+    }
+
+    /**
+     * Overloaded operator * for multiplication of two MPInt instances
+     * Multiplication of two MPInts is done by multiplying the digits of the numbers and carrying over the sign
+     * The sign of the result is the product of the signs of the two operands
+     * @tparam max_digits_other Maximum number of digits in the other MPInt instance
+     * @param other Other MPInt instance
+     * @return Product of the two MPInt instances with the same number of digits as the maximum number of digits of
+     *         the two
+     */
+    template<T max_digits_other>
+    constexpr MPInt<T, MaxDigits<max_digits, max_digits_other>::value, Limbs> operator*(const MPInt<T, max_digits_other, Limbs> &other) const & {
+        Storage one{1};
+
+        // Check if one of the numbers is zero
+        if (isZero() || other.isZero())
+            return {{0}, 1};
+
+            // Check if one of the numbers is one
+        else if (mNumber == one && mSign == 1)
+            return {other.getNumber(), other.getSign()};
+        else if (other.getNumber() == one && other.getSign() == 1)
+            return {mNumber, mSign};
+
+            // Check if one of the numbers is minus one
+        else if (mNumber == one && mSign == -1)
+            return {other.getNumber(), -other.getSign()};
+        else if (other.getNumber() == one && other.getSign() == -1)
+            return {mNumber, -mSign};
+
+        // Multiply
+        return {mul<Limbs>(mNumber, other.getNumber()), mSign * other.getSign()};
+    }
+
+    /**
+     * Overloaded operator * for multiplication of two MPInt instances, where this instance is a temporary
+     * The product is moved to this instance and returned (if the result has the same type)
+     * @tparam max_digits_other Maximum number of digits in the other MPInt instance
+     * @param other Other MPInt instance
+     * @return Product of the two MPInt instances with the same number of digits as the maximum number of digits of
+     *         the two
+     */
+    template<T max_digits_other>
+    constexpr MPInt<T, MaxDigits<max_digits, max_digits_other>::value, Limbs> operator*(const MPInt<T, max_digits_other, Limbs> &other) && {
+        if constexpr (MaxDigits<max_digits, max_digits_other>::value == max_digits) {
+            *this *= other;
+            return std::move(*this);
+        } else {
+            return static_cast<const MPInt &>(*this) * other;
+        }
+    }
+
+    /**
+     * Overloaded operator *= for multiplication of two MPInt instances
+     * The product can't be computed in place, but it is moved to this instance (no copy)
+     * @tparam max_digits_other Maximum number of digits in the other MPInt instance
+     * @param other Other MPInt instance
+     * @return This MPInt instance
+     */
+    template<T max_digits_other>
+    constexpr MPInt &operator*=(const MPInt<T, max_digits_other, Limbs> &other) {
+        // Check if the number is too large for the given number of digits
+        if (MaxDigits<max_digits, max_digits_other>::value != max_digits)
+            throw MyOverflowException(
+                    "Number " + (*this * other).toString() + " is too big for " + std::to_string(max_digits) +
+                    " digits");
+        if (isZero() || other.isZero()) {
+            mNumber = {0};
+            mSign = 1;
+            return *this;
+        }
+        // Constructor checks the number of digits before anything is stored
+        MPInt result{mul<Limbs>(mNumber, other.getNumber()), mSign * other.getSign()};
+        *this = std::move(result);
+        return *this;
+    }
+
+    /**
+     * Overloaded operator / for division of two MPInt instances
+     * Division of two MPInts is done by dividing this number by the other number and carrying over the sign
+     * The sign of the result is the product of the signs of the two operands
+     * @tparam max_digits_other Maximum number of digits in the other MPInt instance
+     * @param other Other MPInt instance
+     * @return Quotient of the two MPInt instances with the same number of digits as the maximum number of digits of
+     *         the two
+     */
+    template<T max_digits_other>
+    constexpr MPInt<T, MaxDigits<max_digits, max_digits_other>::value, Limbs> operator/(const MPInt<T, max_digits_other, Limbs> &other) const {
+        Storage one{1};
+
+        // Check if the other number is zero
+        if (other.isZero())
+            throw std::invalid_argument("Division by zero is not defined");
+
+        // Check if the result is zero (numerator is smaller than denominator)
+        if (isZero() || [this, &other]() -> bool { // Lambda function to flex... weird flex, but okay
+            if (mNumber.size() < other.getNumber().size())
+                return true;
+            else if (mNumber.size() > other.getNumber().size())
+                return false;
+            else {
+                for (int32_t i = mNumber.size() - 1; i >= 0; i--) {
+                    if (mNumber[i] < other.getNumber()[i])
+                        return true;
+                    else if (mNumber[i] > other.getNumber()[i])
+                        return false;
+                }
+                return false;
+            }
+        }())
+            return {{0}, 1};
+            // Check if the result is one or minus one
+        else if (getNumber() == other.getNumber())
+            return {{1}, mSign * other.getSign()};
+            // Check if the result is the numerator (or -numerator)
+        else if (other.getNumber() == one)
+            return {{mNumber}, mSign * other.getSign()};
+
+        // Divide
+        if (other.getNumber().size() == 1) // Small division
+            return {div<Limbs>(mNumber, other.getNumber()[0]), mSign * other.getSign()};
+        else // Large division
+            return {div<Limbs>(mNumber, other.getNumber()), mSign * other.getSign()};
+    }
+
+    /**
+     * Overloaded operator /= for division of two MPInt instances
+     * Uses the overloaded operator / for division
+     * @tparam max_digits_other Maximum number of digits in the other MPInt instance
+     * @param other Other MPInt instance
+     * @return This MPInt instance
+     */
+    template<T max_digits_other>
+    constexpr MPInt &operator/=(const MPInt<T, max_digits_other, Limbs> &other) {
+        auto result = *this / other;
+        // No need to check if the number is too large for the given number of digits because it's division
+        // Copy the result to this instance
+        mNumber = result.getNumber();
+        mSign = result.getSign();
+        return *this;
+    }
+
+    /**
+     * Overloaded operator % for modulo of two MPInt instances
+     * The remainder has the sign of this number (the same as this - (this / other) * other)
+     * @tparam max_digits_other Maximum number of digits in the other MPInt instance
+     * @param other Other MPInt instance
+     * @return Modulo of the two MPInt instances with the same number of digits as the maximum number of digits
+     */
+    template<T max_digits_other>
+    constexpr MPInt<T, MaxDigits<max_digits, max_digits_other>::value, Limbs> operator%(const MPInt<T, max_digits_other, Limbs> &other) const {
+        // Check if the other number is zero
+        if (other.isZero())
+            throw std::invalid_argument("Modulo by zero is not defined");
+
+        // Only the remainder is computed, the quotient is never stored
+        auto remainder = mod<Limbs>(mNumber, other.getNumber());
+        if (remainder.size() == 1 && remainder[0] == 0)
+            return {{0}, 1}; // To avoid negative zero
+        return {remainder, mSign};
+    }
+
+    /**
+     * Overloaded operator ! for factorial of an MPInt instance
+     * Factorial of an MPInt is done by multiplying all numbers from 1 to the number
+     * @return Factorial of the MPInt instance with the same number of digits as this MPInt instance
+     */
+    MPInt operator!() {
+        if (mSign == -1)
+            throw std::invalid_argument("Factorial of a negative number is not defined");
+        if (mNumber[0] == 0)
+            return MPInt{{1}, 1};
+        return factorial();
+    }
+
+    /**
+     * Overloaded spaceship operator <=> for comparison of two MPInt instances
+     * First the signs are compared, if they are equal, then
+     * The sizes of the number vectors are compared, if they are equal, then
+     * The digits of the numbers are compared from the most significant digit to the least significant digit
+     * @tparam max_digits_other Maximum number of digits in the other MPInt instance
+     * @param other Other MPInt instance
+     * @return Result of the comparison
+     */
+    template<T max_digits_other>
+    constexpr std::strong_ordering operator<=>(const MPInt<T, max_digits_other, Limbs> &other) const {
+        // Compare the signs
+        if (mSign != other.getSign())
+            return mSign <=> other.getSign();
+
+        // Compare the sizes of the number vectors
+        if (mNumber.size() != other.getNumber().size()) {
+            if (mSign == 1)
+                return mNumber.size() <=> other.getNumber().size();
+            else
+                return other.getNumber().size() <=> mNumber.size();
+        }
+
+        // Compare the digits of the numbers
+        for (int32_t i = mNumber.size() - 1; i >= 0; i--) {
+            if (mNumber[i] != other.getNumber()[i]) {
+                if (mSign == 1)
+                    return mNumber[i] <=> other.getNumber()[i];
+                else
+                    return other.getNumber()[i] <=> mNumber[i];
+            }
+        }
+
+        // The numbers are equal
+        return std::strong_ordering::equal;
+    }
+
+    /**
+     * Overloaded operator == for equality of two MPInt instances
+     * Uses the overloaded spaceship operator <=> for comparison
+     * @tparam max_digits_other Maximum number of digits in the other MPInt instance
+     * @param other Other MPInt instance
+     * @return Result of the comparison
+     */
+    template<T max_digits_other>
+    constexpr bool operator==(const MPInt<T, max_digits_other, Limbs> &other) const {
+        return ((*this <=> other) == std::strong_ordering::equal);
+    }
+
+    /**
+     * Overloaded operator << for printing an MPInt instance
+     * Decimal digits are written to the stream in blocks (no string of the whole number is created)
+     * @param os Output stream
+     * @param num MPInt instance
+     * @return Output stream
+     */
+    friend std::ostream &operator<<(std::ostream &os, const MPInt &num) {
+        // If the number is negative, add a minus sign
+        if (num.mSign == -1)
+            os << "-";
+        // Binary digits are converted to the decimal ones first
+        auto decimal = convert_base<Limbs, DecimalLimbs>(num.mNumber);
+        os << decimal.back();
+
+        // Other digits have all their leading zeros, they are collected in the buffer and written at once
+        constexpr size_t DIGITS_PER_WRITE = 512;
+        char buffer[DIGITS_PER_WRITE * MAX_DIGITS];
+        size_t length = 0;
+        for (auto i = static_cast<int64_t>(decimal.size()) - 2; i >= 0; i--) {
+            formatDigit(decimal[i], buffer + length);
+            length += MAX_DIGITS;
+            if (length == sizeof(buffer)) {
+                os.write(buffer, static_cast<std::streamsize>(length));
+                length = 0;
+            }
+        }
+        os.write(buffer, static_cast<std::streamsize>(length));
+        return os;
+    }
+
+    /**
+     * This method returns the string representation of the number
+     * @return String representation of the number
+     */
+    [[nodiscard]] std::string toString() const {
+        // Binary digits are converted to the decimal ones first
+        auto decimal = convert_base<Limbs, DecimalLimbs>(mNumber);
+        // If the number is negative, add a minus sign
+        std::string result = mSign == -1 ? "-" : "";
+        result.reserve(decimal.size() * MAX_DIGITS + 1);
+        // Add the digits of the number from the most significant digit to the least significant digit
+        result += std::to_string(decimal.back());
+        result.resize(result.size() + (decimal.size() - 1) * MAX_DIGITS);
+        char *digits = result.data() + result.size() - (decimal.size() - 1) * MAX_DIGITS;
+        for (auto i = static_cast<int64_t>(decimal.size()) - 2; i >= 0; i--, digits += MAX_DIGITS)
+            formatDigit(decimal[i], digits);
+        return result;
+    }
+
+    /**
+     * Returns the number of bits of the absolute value of the number (0 for zero)
+     * @return Number of bits
+     */
+    [[nodiscard]] constexpr uint64_t bitLength() const {
+        if constexpr (Limbs::BINARY) {
+            return (mNumber.size() - 1) * 32 + std::bit_width(mNumber.back());
+        } else {
+            auto binary = convert_base<Limbs, BinaryLimbs>(mNumber);
+            return (binary.size() - 1) * 32 + std::bit_width(binary.back());
+        }
+    }
+
+    /**
+     * Returns the bit of the absolute value of the number
+     * @param index Index of the bit (0 is the least significant bit)
+     * @return Value of the bit
+     */
+    [[nodiscard]] constexpr bool testBit(uint64_t index) const {
+        if constexpr (Limbs::BINARY) {
+            return index / 32 < mNumber.size() && (mNumber[index / 32] >> (index % 32)) & 1;
+        } else {
+            auto binary = convert_base<Limbs, BinaryLimbs>(mNumber);
+            return index / 32 < binary.size() && (binary[index / 32] >> (index % 32)) & 1;
+        }
+    }
+
+    /**
+     * Returns the bits of the absolute value of the number from the most significant one
+     * (without leading zeros, zero has no bits)
+     * @return Vector of bits
+     */
+    [[nodiscard]] std::vector<bool> toBits() const {
+        auto binary = convert_base<Limbs, BinaryLimbs>(mNumber);
+        std::vector<bool> bits(bitLength());
+        for (uint64_t i = 0; i < bits.size(); i++)
+            bits[bits.size() - 1 - i] = (binary[i / 32] >> (i % 32)) & 1;
+        return bits;
+    }
+
+    /**
+     * Creates a non-negative number from bits (the most significant bit first)
+     * @param bits Vector of bits
+     * @return MPInt with the value of the bits
+     */
+    static MPInt fromBits(const std::vector<bool> &bits) {
+        std::vector<uint32_t> binary(bits.size() / 32 + 1, 0);
+        for (uint64_t i = 0; i < bits.size(); i++)
+            if (bits[bits.size() - 1 - i])
+                binary[i / 32] |= 1u << (i % 32);
+        while (binary.size() > 1 && binary.back() == 0)
+            binary.pop_back();
+        return {convert_base<BinaryLimbs, Limbs>(binary), 1};
+    }
+
+    /**
+     * Overloaded operator << for shifting the number to the left (multiplication by 2^shift), sign is kept
+     * @param shift Number of bits to shift by
+     * @return Shifted number
+     */
+    constexpr MPInt operator<<(uint64_t shift) const {
+        auto binary = convert_base<Limbs, BinaryLimbs>(mNumber);
+        if (binary == std::vector<uint32_t>{0})
+            return *this;
+        std::vector<uint32_t> result_number(shift / 32, 0);
+        uint32_t carry = 0;
+        for (auto digit: binary) {
+            result_number.push_back(shift % 32 ? (digit << (shift % 32)) | carry : digit);
+            carry = shift % 32 ? digit >> (32 - shift % 32) : 0;
+        }
+        if (carry)
+            result_number.push_back(carry);
+        return {convert_base<BinaryLimbs, Limbs>(result_number), mSign};
+    }
+
+    /**
+     * Overloaded operator >> for shifting the absolute value of the number to the right (division by 2^shift rounded
+     * towards zero), sign is kept
+     * @param shift Number of bits to shift by
+     * @return Shifted number
+     */
+    constexpr MPInt operator>>(uint64_t shift) const {
+        auto binary = convert_base<Limbs, BinaryLimbs>(mNumber);
+        if (shift / 32 >= binary.size())
+            return {{0}, 1};
+        std::vector<uint32_t> result_number;
+        for (uint64_t i = shift / 32; i < binary.size(); i++) {
+            uint64_t digit = binary[i] >> (shift % 32);
+            if (shift % 32 && i + 1 < binary.size())
+                digit |= static_cast<uint64_t>(binary[i + 1]) << (32 - shift % 32);
+            result_number.push_back(static_cast<uint32_t>(digit));
+        }
+        while (result_number.size() > 1 && result_number.back() == 0)
+            result_number.pop_back();
+        if (result_number == std::vector<uint32_t>{0})
+            return {{0}, 1};
+        return {convert_base<BinaryLimbs, Limbs>(result_number), mSign};
+    }
+
+    /**
+     * Getter for the number
+     * @return Number
+     */
+    [[nodiscard]] constexpr const Storage &getNumber() const {
+        return mNumber;
+    }
+
+    /**
+     * Checks if the number is zero
+     * @return True if the number is zero
+     */
+    [[nodiscard]] constexpr bool isZero() const {
+        return mNumber.size() == 1 && mNumber[0] == 0;
+    }
+
+    /**
+     * Getter for the sign
+     * @return Sign
+     */
+    [[nodiscard]] constexpr int32_t getSign() const {
+        return mSign;
+    }
+
+};
+
+/**
+ * Modular context for repeated reductions modulo the same number (Barrett reduction)
+ * The reciprocal mu = floor(B^(2n + 2) / modulus) (n is the number of digits of the modulus) is computed only once,
+ * every reduction of a number smaller than B^(2n + 2) then costs about one and a half multiplication of n digit
+ * numbers and at most three subtractions instead of a long division
+ * Two extra digits allow mulmod() of operands with up to n + 1 digits without reducing them first
+ * Bigger numbers fall back to the long division
+ * Results are always in the range [0, modulus), even for negative numbers
+ * @tparam max_digits Maximum number of digits of the modulus (excluding the sign) (UNLIMITED is possible)
+ * @tparam Limbs Base of the digits (DecimalLimbs or BinaryLimbs)
+ */
+template<ValidDigit T, T max_digits, LimbBackend Limbs = DecimalLimbs>
+class ModContext {
+private:
+    /** Number of extra digits of the reciprocal (inputs can have up to 2n + EXTRA digits) */
+    static constexpr size_t EXTRA = 2;
+    /** Storage of the digits of the modulus and the results */
+    using Digits = typename MPInt<T, max_digits, Limbs>::Storage;
+    /** Storage of the products and the temporary results (inline for moduli up to 512 bits) */
+    using WideDigits = LimbStorage<4 * SMALL_BUFFER_DIGITS>;
+
+    /** Digits of the modulus */
+    Digits mModulus;
+    /** Digits of the Barrett reciprocal floor(B^(2n + EXTRA) / modulus) */
+    Digits mMu;
+    /** Number of digits of the modulus (n) */
+    size_t mSize;
+
+    /**
+     * Barrett reduction of a non-negative number with at most 2n + EXTRA digits (HAC, Algorithm 14.42)
+     * q = floor(floor(num / B^(n - 1)) * mu / B^(n + 1 + EXTRA)) is at most 2 smaller than floor(num / modulus), so
+     * num - q * modulus < 3 * modulus < B^(n + 1) and only the lowest n + 1 digits of q * modulus are needed
+     * @param num Number to be reduced
+     * @param size Number of digits of num
+     * @return Number modulo the modulus
+     */
+    [[nodiscard]] Digits barrett(const uint32_t *num, size_t size) const {
+        if (size < mSize || (size == mSize && compare(std::span<const uint32_t>(num, size), mModulus) < 0))
+            return {num, num + size};
+
+        const size_t n = mSize;
+        const size_t q1_size = size - (n - 1);
+        // One buffer for q1 * mu and the remainder
+        WideDigits buffer(q1_size + mMu.size() + n + 1, 0);
+        uint32_t *q2 = buffer.data();
+        uint32_t *r = q2 + q1_size + mMu.size();
+
+        // q2 = q1 * mu, q3 are its digits from n + 1 + EXTRA up
+        for (size_t i = 0; i < q1_size; i++) {
+            uint64_t carry = 0;
+            for (size_t j = 0; j < mMu.size(); j++) {
+                uint64_t sum = q2[i + j] + static_cast<uint64_t>(num[n - 1 + i]) * mMu[j] + carry;
+                carry = sum / Limbs::BASE;
+                q2[i + j] = sum % Limbs::BASE;
+            }
+            q2[i + mMu.size()] = carry;
+        }
+        const uint32_t *q3 = q2 + n + 1 + EXTRA;
+        const size_t q3_size = q1_size + mMu.size() > n + 1 + EXTRA ? q1_size + mMu.size() - (n + 1 + EXTRA) : 0;
+
+        // r = num - q3 * modulus modulo B^(n + 1) (only the lowest n + 1 digits of the product are computed)
+        std::copy(num, num + std::min(size, n + 1), r);
+        for (size_t i = 0; i < q3_size && i <= n; i++) {
+            uint64_t carry = 0;
+            int64_t borrow = 0;
+            for (size_t j = 0; i + j <= n; j++) {
+                uint64_t product = (j < n ? static_cast<uint64_t>(q3[i]) * mModulus[j] : 0) + carry;
+                carry = product / Limbs::BASE;
+                auto diff = static_cast<int64_t>(r[i + j]) - static_cast<int64_t>(product % Limbs::BASE) - borrow;
+                borrow = diff < 0;
+                r[i + j] = diff + borrow * static_cast<int64_t>(Limbs::BASE);
+            }
+            // Borrow out of the digit n is dropped (modulo B^(n + 1))
+        }
+
+        // Correction of the estimate of q
+        Digits remainder(r, r + limbs_length(r, n + 1));
+        while (compare(remainder, mModulus) >= 0)
+            remainder = sub<Limbs>(remainder, mModulus);
+        return remainder;
+    }
+
+    /**
+     * Reduces non-negative digits modulo the modulus (Barrett reduction if the number is small enough)
+     * @param num Number to be reduced
+     * @tparam Num Container of the digits of the number
+     * @return Number modulo the modulus
+     */
+    template<typename Num>
+    [[nodiscard]] Digits reduceDigits(const Num &num) const {
+        if (num.size() <= 2 * mSize + EXTRA)
+            return barrett(num.data(), num.size());
+        return mod<Limbs>(Digits(num), mModulus);
+    }
+
+public:
+    /**
+     * Constructor for the ModContext class, precomputes the Barrett reciprocal
+     * @param modulus Modulus (has to be positive)
+     */
+    explicit ModContext(const MPInt<T, max_digits, Limbs> &modulus) : mModulus(modulus.getNumber()), mMu(),
+                                                                      mSize(mModulus.size()) {
+        if (modulus.getSign() == -1 || modulus.isZero())
+            throw std::invalid_argument("Modulus has to be positive");
+
+        // mu = floor(B^(2n + EXTRA) / modulus)
+        std::vector<uint32_t> power(2 * mSize + EXTRA + 1, 0);
+        power.back() = 1;
+        mMu = Digits(div<Limbs>(power, mModulus));
+    }
+
+    /**
+     * Reduces the number modulo the modulus
+     * @tparam max_digits_other Maximum number of digits in the number
+     * @param num Number to be reduced
+     * @return Number modulo the modulus in the range [0, modulus)
+     */
+    template<T max_digits_other>
+    MPInt<T, max_digits, Limbs> reduce(const MPInt<T, max_digits_other, Limbs> &num) const {
+        auto remainder = reduceDigits(num.getNumber());
+        // Negative numbers are shifted to the range [0, modulus)
+        if (num.getSign() == -1 && !(remainder.size() == 1 && remainder[0] == 0))
+            remainder = sub<Limbs>(mModulus, remainder);
+        return {remainder, 1};
+    }
+
+    /**
+     * Multiplies two numbers modulo the modulus
+     * Operands with more than n + 1 digits are reduced first, so their product always fits the Barrett reduction
+     * @tparam max_digits1 Maximum number of digits in the first number
+     * @tparam max_digits2 Maximum number of digits in the second number
+     * @param num1 Number to be multiplied
+     * @param num2 Number to be multiplied
+     * @return Product of the numbers modulo the modulus in the range [0, modulus)
+     */
+    template<T max_digits1, T max_digits2>
+    MPInt<T, max_digits, Limbs> mulmod(const MPInt<T, max_digits1, Limbs> &num1,
+                                       const MPInt<T, max_digits2, Limbs> &num2) const {
+        WideDigits digits1 = num1.getNumber();
+        WideDigits digits2 = num2.getNumber();
+        if (digits1.size() > mSize + 1)
+            digits1 = reduceDigits(digits1);
+        if (digits2.size() > mSize + 1)
+            digits2 = reduceDigits(digits2);
+
+        auto product = mul<Limbs>(digits1, digits2);
+        auto remainder = barrett(product.data(), product.size());
+        // Sign of the product decides the sign of the residue
+        if (num1.getSign() * num2.getSign() == -1 && !(remainder.size() == 1 && remainder[0] == 0))
+            remainder = sub<Limbs>(mModulus, remainder);
+        return {remainder, 1};
+    }
+
+    /**
+     * Getter for the modulus
+     * @return Modulus
+     */
+    [[nodiscard]] MPInt<T, max_digits, Limbs> getModulus() const {
+        return {mModulus, 1};
+    }
+};
+
+/**
+ * Number of the leading bits of the remainders the Lehmer's steps are simulated on (see ext_gcd_lehmer_digits())
+ * 62 bits leave room for the signed cofactors in int64_t
+ */
+constexpr uint64_t LEHMER_BITS = 62;
+/** Largest cofactor of one Lehmer's matrix (cofactors have to be one digit multipliers) */
+constexpr uint64_t LEHMER_MAX_COFACTOR = UINT32_MAX;
+
+/**
+ * Returns the number of bits of a number
+ * @param num Binary digits of the number (base 2^32)
+ * @return Number of bits (0 for zero)
+ */
+inline uint64_t bit_length(const std::vector<uint32_t> &num) {
+    return (num.size() - 1) * 32 + std::bit_width(num.back());
+}
+
+/**
+ * Returns 64 bits of a number starting at the given bit
+ * @param num Binary digits of the number (base 2^32)
+ * @param shift Index of the lowest returned bit
+ * @return floor(num / 2^shift) truncated to 64 bits
+ */
+inline uint64_t leading_bits(const std::vector<uint32_t> &num, uint64_t shift) {
+    auto digit = [&num](size_t i) -> uint64_t { return i < num.size() ? num[i] : 0; };
+    const size_t first = shift / 32;
+    const uint64_t bit = shift % 32;
+    uint64_t res = (digit(first) | digit(first + 1) << 32) >> bit;
+    if (bit)
+        res |= digit(first + 2) << (64 - bit);
+    return res;
+}
+
+/**
+ * Shifts a number to the right in place (num /= 2^shift)
+ * @param num Binary digits of the number (base 2^32)
+ * @param shift Number of bits
+ */
+inline void shift_right_in_place(std::vector<uint32_t> &num, uint64_t shift) {
+    const size_t words = std::min<size_t>(shift / 32, num.size());
+    const uint64_t bit = shift % 32;
+    num.erase(num.begin(), num.begin() + static_cast<long>(words));
+    if (num.empty()) {
+        num.push_back(0);
+        return;
+    }
+    if (bit) {
+        for (size_t i = 0; i < num.size(); i++)
+            num[i] = (num[i] >> bit) | (i + 1 < num.size() ? num[i + 1] << (32 - bit) : 0);
+    }
+
+    // Remove the leading zeros from the result
+    while (num.size() > 1 && num.back() == 0)
+        num.pop_back();
+}
+
+/**
+ * Linear combination of two numbers with one digit coefficients (result = num1 * c1 + num2 * c2)
+ * @param result Result (must not be one of the numbers)
+ * @param num1 First number
+ * @param c1 Coefficient of the first number
+ * @param num2 Second number
+ * @param c2 Coefficient of the second number
+ * @tparam Limbs Base of the digits
+ */
+template<LimbBackend Limbs = DecimalLimbs>
+void lin_comb_add(std::vector<uint32_t> &result, const std::vector<uint32_t> &num1, uint32_t c1,
+                  const std::vector<uint32_t> &num2, uint32_t c2) {
+    const size_t size = std::max(num1.size(), num2.size());
+    result.resize(size + 1);
+    // Both products have their own carry, the sum of two products doesn't fit into 64 bits
+    uint64_t carry1 = 0, carry2 = 0, carry = 0;
+    for (size_t i = 0; i < size; i++) {
+        uint64_t product1 = (i < num1.size() ? static_cast<uint64_t>(num1[i]) * c1 : 0) + carry1;
+        uint64_t product2 = (i < num2.size() ? static_cast<uint64_t>(num2[i]) * c2 : 0) + carry2;
+        carry1 = product1 / Limbs::BASE;
+        carry2 = product2 / Limbs::BASE;
+        uint64_t sum = product1 % Limbs::BASE + product2 % Limbs::BASE + carry;
+        carry = sum / Limbs::BASE;
+        result[i] = sum % Limbs::BASE;
+    }
+    result[size] = carry1 + carry2 + carry;
+
+    // Remove the leading zeros from the result
+    while (result.size() > 1 && result.back() == 0)
+        result.pop_back();
+}
+
+/**
+ * Linear combination of two numbers with one digit coefficients (result = num1 * c1 - num2 * c2)
+ * It is expected that the result is not negative
+ * @param result Result (must not be one of the numbers)
+ * @param num1 Number to be subtracted from
+ * @param c1 Coefficient of the first number
+ * @param num2 Number to be subtracted
+ * @param c2 Coefficient of the second number
+ * @tparam Limbs Base of the digits
+ */
+template<LimbBackend Limbs = DecimalLimbs>
+void lin_comb_sub(std::vector<uint32_t> &result, const std::vector<uint32_t> &num1, uint32_t c1,
+                  const std::vector<uint32_t> &num2, uint32_t c2) {
+    const size_t size = std::max(num1.size(), num2.size()) + 1;
+    result.resize(size);
+    uint64_t carry1 = 0, carry2 = 0;
+    int64_t borrow = 0;
+    for (size_t i = 0; i < size; i++) {
+        uint64_t product1 = (i < num1.size() ? static_cast<uint64_t>(num1[i]) * c1 : 0) + carry1;
+        uint64_t product2 = (i < num2.size() ? static_cast<uint64_t>(num2[i]) * c2 : 0) + carry2;
+        carry1 = product1 / Limbs::BASE;
+        carry2 = product2 / Limbs::BASE;
+        auto diff = static_cast<int64_t>(product1 % Limbs::BASE) - static_cast<int64_t>(product2 % Limbs::BASE) - borrow;
+        borrow = diff < 0;
+        result[i] = diff + borrow * static_cast<int64_t>(Limbs::BASE);
+    }
+
+    // Remove the leading zeros from the result
+    while (result.size() > 1 && result.back() == 0)
+        result.pop_back();
+}
+
+/**
+ * Extended greatest common divisor by the Lehmer's algorithm (Knuth, TAOCP Vol. 2, 4.5.2, Algorithm L)
+ * Euclid's steps are simulated on the leading LEHMER_BITS bits of both remainders as long as the quotient is provably
+ * the real one (the quotients of both bounds of the remainders are the same), the collected 2x2 matrix of one digit
+ * cofactors is then applied to the whole remainders at once - a few linear passes over the digits replace tens of
+ * long divisions and multiplications
+ * Only if no step can be simulated (the quotient is too big), one full step with a long division is done
+ * Cofactors of the Euclid's algorithm alternate in sign, so only their absolute values are stored
+ * @param a Binary digits of the number (base 2^32, a < b)
+ * @param b Binary digits of the modulus (b > 0)
+ * @param gcd gcd(a, b) (output)
+ * @param cofactor x from [0, b) such that a * x = gcd(a, b) (mod b) (output)
+ */
+inline void ext_gcd_lehmer_digits(const std::vector<uint32_t> &a, const std::vector<uint32_t> &b,
+                                  std::vector<uint32_t> *gcd, std::vector<uint32_t> *cofactor) {
+    // r0 = s0 * a (mod b), r1 = s1 * a (mod b), next0 and next1 are buffers of the next values
+    std::vector<uint32_t> r0 = b, r1 = a, s0{0}, s1{1}, next0, next1;
+    // Sign of the cofactor s0 (s1 has always the opposite sign)
+    bool negative = true;
+
+    while (r1.size() > 1 || r1[0]) {
+        const uint64_t length = bit_length(r0);
+        const uint64_t shift = length > LEHMER_BITS ? length - LEHMER_BITS : 0;
+        auto x = static_cast<int64_t>(leading_bits(r0, shift)), y = static_cast<int64_t>(leading_bits(r1, shift));
+
+        // Matrix of the simulated steps (the cofactors of the leading bits)
+        int64_t A = 1, B = 0, C = 0, D = 1;
+        bool odd = false;
+        while (y + C > 0 && y + D > 0 && x + A >= 0 && x + B >= 0) {
+            const int64_t q = (x + A) / (y + C);
+            if (q != (x + B) / (y + D) || static_cast<uint64_t>(q) > LEHMER_MAX_COFACTOR)
+                break;
+            // Signs alternate, so |A - q * C| = |A| + q * |C|
+            if (static_cast<uint64_t>(std::abs(A)) + static_cast<uint64_t>(q) * std::abs(C) > LEHMER_MAX_COFACTOR ||
+                static_cast<uint64_t>(std::abs(B)) + static_cast<uint64_t>(q) * std::abs(D) > LEHMER_MAX_COFACTOR)
+                break;
+            int64_t t = A - q * C;
+            A = C;
+            C = t;
+            t = B - q * D;
+            B = D;
+            D = t;
+            t = x - q * y;
+            x = y;
+            y = t;
+            odd = !odd;
+        }
+
+        if (!B) {
+            // No step could be simulated, one full step
+            std::vector<uint32_t> quotient, remainder;
+            divmod<BinaryLimbs>(r0, r1, &quotient, &remainder);
+            next1 = mul<BinaryLimbs>(quotient, s1);
+            add_in_place<BinaryLimbs>(next1, s0);
+            r0 = std::move(r1);
+            r1 = std::move(remainder);
+            std::swap(s0, s1);
+            std::swap(s1, next1);
+            negative = !negative;
+            continue;
+        }
+
+        const auto a0 = static_cast<uint32_t>(std::abs(A)), b0 = static_cast<uint32_t>(std::abs(B)),
+                   c0 = static_cast<uint32_t>(std::abs(C)), d0 = static_cast<uint32_t>(std::abs(D));
+        // Even number of steps: A >= 0, B <= 0, C <= 0, D >= 0, odd number of steps: the opposite signs
+        if (!odd) {
+            lin_comb_sub<BinaryLimbs>(next0, r0, a0, r1, b0);
+            lin_comb_sub<BinaryLimbs>(next1, r1, d0, r0, c0);
+        } else {
+            lin_comb_sub<BinaryLimbs>(next0, r1, b0, r0, a0);
+            lin_comb_sub<BinaryLimbs>(next1, r0, c0, r1, d0);
+        }
+        std::swap(r0, next0);
+        std::swap(r1, next1);
+        lin_comb_add<BinaryLimbs>(next0, s0, a0, s1, b0);
+        lin_comb_add<BinaryLimbs>(next1, s0, c0, s1, d0);
+        std::swap(s0, next0);
+        std::swap(s1, next1);
+        negative ^= odd;
+    }
+
+    if (compare(s0, b) >= 0)
+        s0 = mod<BinaryLimbs>(s0, b);
+    if (negative && (s0.size() > 1 || s0[0]))
+        sub_reverse_in_place<BinaryLimbs>(s0, b);
+    *gcd = std::move(r0);
+    *cofactor = std::move(s0);
+}
+
+/**
+ * Modular inverse by the binary (shift and subtract) extended Euclid's algorithm for an odd modulus
+ * Both remainders u and v are divided by 2 while they are even and the smaller one is subtracted from the bigger
+ * one, their cofactors are divided by the same powers of 2 modulo the modulus (a multiple of the modulus is added
+ * first, so the lowest bits are zero)
+ * There is no long division at all, but every subtraction costs a few linear passes over the digits
+ * @param a Binary digits of the number (base 2^32, a < m)
+ * @param m Binary digits of the modulus (odd)
+ * @param inverse x from [0, m) such that a * x = 1 (mod m) (output)
+ * @return True if the inverse exists, false otherwise
+ */
+inline bool mod_inverse_binary_digits(const std::vector<uint32_t> &a, const std::vector<uint32_t> &m,
+                                      std::vector<uint32_t> *inverse) {
+    // u = x1 * a (mod m), v = x2 * a (mod m)
+    std::vector<uint32_t> u = a, v = m, x1{1}, x2{0};
+    auto is_zero = [](const std::vector<uint32_t> &num) { return num.size() == 1 && !num[0]; };
+    auto is_one = [](const std::vector<uint32_t> &num) { return num.size() == 1 && num[0] == 1; };
+    // -m^(-1) mod 2^32 (Newton's iteration, every step doubles the number of correct bits)
+    uint32_t m_inverse = m[0];
+    for (int i = 0; i < 4; i++)
+        m_inverse *= 2 - m[0] * m_inverse;
+    m_inverse = 0 - m_inverse;
+    std::vector<uint32_t> sum;
+    auto halve = [&m, m_inverse, &sum](std::vector<uint32_t> &u, std::vector<uint32_t> &x) {
+        while (!(u[0] & 1)) {
+            // Up to 32 trailing zeros are removed at once, x / 2^zeros = (x + t * m) / 2^zeros (mod m) where
+            // t = -x * m^(-1) mod 2^zeros makes the lowest bits of the sum zero
+            const uint64_t zeros = std::countr_zero(u[0]);
+            shift_right_in_place(u, zeros);
+            const uint32_t t = static_cast<uint32_t>((x[0] * m_inverse) & ((uint64_t{1} << zeros) - 1));
+            lin_comb_add<BinaryLimbs>(sum, x, 1, m, t);
+            shift_right_in_place(sum, zeros);
+            std::swap(x, sum);
+        }
+    };
+    auto sub_mod = [&m](std::vector<uint32_t> &x1, const std::vector<uint32_t> &x2) {
+        if (compare(x1, x2) < 0)
+            add_in_place<BinaryLimbs>(x1, m);
+        sub_in_place<BinaryLimbs>(x1, x2);
+    };
+
+    // Zero is invertible only modulo 1 (everything is 0 there)
+    if (is_zero(u)) {
+        if (!is_one(m))
+            return false;
+        *inverse = {0};
+        return true;
+    }
+    while (!is_one(u) && !is_one(v)) {
+        halve(u, x1);
+        halve(v, x2);
+        if (compare(u, v) >= 0) {
+            sub_in_place<BinaryLimbs>(u, v);
+            sub_mod(x1, x2);
+        } else {
+            sub_in_place<BinaryLimbs>(v, u);
+            sub_mod(x2, x1);
+        }
+        // gcd(a, m) is the remaining non-zero remainder, which is not 1
+        if (is_zero(u) || is_zero(v))
+            return false;
+    }
+
+    *inverse = is_one(u) ? std::move(x1) : std::move(x2);
+    return true;
+}
+
+/**
+ * Returns the binary digits (base 2^32) of the absolute value of a number
+ * @param num Number
+ * @tparam max_digits Maximum number of digits of the number
+ * @tparam Limbs Base of the digits of the number
+ * @return Binary digits
+ */
+template<ValidDigit T, T max_digits, LimbBackend Limbs>
+std::vector<uint32_t> binary_digits(const MPInt<T, max_digits, Limbs> &num) {
+    if constexpr (Limbs::BINARY)
+        return {num.getNumber().begin(), num.getNumber().end()};
+    else
+        return convert_base<Limbs, BinaryLimbs>(num.getNumber());
+}
+
+/**
+ * Creates a non-negative number from its binary digits (base 2^32)
+ * @param digits Binary digits
+ * @tparam max_digits Maximum number of digits of the number
+ * @tparam Limbs Base of the digits of the number
+ * @return Number
+ */
+template<ValidDigit T, T max_digits, LimbBackend Limbs>
+MPInt<T, max_digits, Limbs> from_binary_digits(const std::vector<uint32_t> &digits) {
+    if constexpr (Limbs::BINARY)
+        return {typename MPInt<T, max_digits, Limbs>::Storage(digits), 1};
+    else
+        return {typename MPInt<T, max_digits, Limbs>::Storage(convert_base<BinaryLimbs, Limbs>(digits)), 1};
+}
+
+/**
+ * Checks the operands of the modular inverse and returns the binary digits of the number reduced modulo the modulus
+ * @param a Number (non-negative)
+ * @param m Modulus (positive)
+ * @param m_digits Binary digits of the modulus (output)
+ * @tparam max_digits Maximum number of digits of the numbers
+ * @tparam Limbs Base of the digits of the numbers
+ * @return Binary digits of a mod m
+ */
+template<ValidDigit T, T max_digits, LimbBackend Limbs>
+std::vector<uint32_t> inverse_operands(const MPInt<T, max_digits, Limbs> &a, const MPInt<T, max_digits, Limbs> &m,
+                                       std::vector<uint32_t> *m_digits) {
+    if (m.getSign() < 0 || m.isZero())
+        throw std::invalid_argument("Modulus has to be positive");
+    if (a.getSign() < 0)
+        throw std::invalid_argument("Only non-negative numbers can be inverted");
+    *m_digits = binary_digits(m);
+    auto a_digits = binary_digits(a);
+    if (compare(a_digits, *m_digits) >= 0)
+        a_digits = mod<BinaryLimbs>(a_digits, *m_digits);
+    return a_digits;
+}
+
+/**
+ * Extended greatest common divisor by the Lehmer's algorithm (see ext_gcd_lehmer_digits())
+ * @param a Number (non-negative)
+ * @param m Modulus (positive)
+ * @tparam max_digits Maximum number of digits of the numbers
+ * @tparam Limbs Base of the digits of the numbers
+ * @return gcd(a, m) and x from [0, m) such that a * x = gcd(a, m) (mod m)
+ */
+template<ValidDigit T, T max_digits, LimbBackend Limbs>
+std::pair<MPInt<T, max_digits, Limbs>, MPInt<T, max_digits, Limbs>> ext_gcd(const MPInt<T, max_digits, Limbs> &a,
+                                                                            const MPInt<T, max_digits, Limbs> &m) {
+    std::vector<uint32_t> m_digits, gcd, cofactor;
+    auto a_digits = inverse_operands(a, m, &m_digits);
+    ext_gcd_lehmer_digits(a_digits, m_digits, &gcd, &cofactor);
+    return {from_binary_digits<T, max_digits, Limbs>(gcd), from_binary_digits<T, max_digits, Limbs>(cofactor)};
+}
+
+/**
+ * Modular inverse by the Lehmer's extended greatest common divisor (see ext_gcd_lehmer_digits())
+ * If the inverse doesn't exist (gcd(a, m) != 1), an invalid argument exception is thrown
+ * @param a Number (non-negative)
+ * @param m Modulus (positive)
+ * @tparam max_digits Maximum number of digits of the numbers
+ * @tparam Limbs Base of the digits of the numbers
+ * @return x from [0, m) such that a * x = 1 (mod m)
+ */
+template<ValidDigit T, T max_digits, LimbBackend Limbs>
+MPInt<T, max_digits, Limbs> mod_inverse(const MPInt<T, max_digits, Limbs> &a, const MPInt<T, max_digits, Limbs> &m) {
+    std::vector<uint32_t> m_digits, gcd, cofactor;
+    auto a_digits = inverse_operands(a, m, &m_digits);
+    ext_gcd_lehmer_digits(a_digits, m_digits, &gcd, &cofactor);
+    if (gcd.size() != 1 || gcd[0] != 1)
+        throw std::invalid_argument("Number is not invertible modulo the modulus");
+    return from_binary_digits<T, max_digits, Limbs>(cofactor);
+}
+
+/**
+ * Modular inverse by the binary extended Euclid's algorithm (see mod_inverse_binary_digits())
+ * Even modulus m is handled through the inverse y of m modulo a (a has to be odd then),
+ * a * (1 + m * (a - y)) / a = 1 (mod m)
+ * If the inverse doesn't exist (gcd(a, m) != 1), an invalid argument exception is thrown
+ * @param a Number (non-negative)
+ * @param m Modulus (positive)
+ * @tparam max_digits Maximum number of digits of the numbers
+ * @tparam Limbs Base of the digits of the numbers
+ * @return x from [0, m) such that a * x = 1 (mod m)
+ */
+template<ValidDigit T, T max_digits, LimbBackend Limbs>
+MPInt<T, max_digits, Limbs> mod_inverse_binary(const MPInt<T, max_digits, Limbs> &a,
+                                               const MPInt<T, max_digits, Limbs> &m) {
+    std::vector<uint32_t> m_digits, inverse;
+    auto a_digits = inverse_operands(a, m, &m_digits);
+
+    bool invertible;
+    if (m_digits[0] & 1) {
+        invertible = mod_inverse_binary_digits(a_digits, m_digits, &inverse);
+    } else if (!(a_digits[0] & 1)) {
+        invertible = false;
+    } else if (a_digits.size() == 1 && a_digits[0] == 1) {
+        invertible = true;
+        inverse = {1};
+    } else {
+        // Inverse of m modulo odd a, then (1 + m * (a - y)) / a is the inverse of a modulo m
+        invertible = mod_inverse_binary_digits(mod<BinaryLimbs>(m_digits, a_digits), a_digits, &inverse);
+        if (invertible) {
+            auto complement = a_digits;
+            sub_in_place<BinaryLimbs>(complement, inverse);
+            auto numerator = mul<BinaryLimbs>(m_digits, complement);
+            add_in_place<BinaryLimbs>(numerator, std::vector<uint32_t>{1});
+            inverse = div<BinaryLimbs>(numerator, a_digits);
+        }
+    }
+    if (!invertible)
+        throw std::invalid_argument("Number is not invertible modulo the modulus");
+    return from_binary_digits<T, max_digits, Limbs>(inverse);
+}
+
+/**
+ * Modular inverse by the textbook extended Euclid's algorithm (one long division and two multiplications per step)
+ * Kept as the reference for mod_inverse() and mod_inverse_binary()
+ * If the inverse doesn't exist (gcd(a, m) != 1), an invalid argument exception is thrown
+ * @param a Number (non-negative)
+ * @param m Modulus (positive)
+ * @tparam max_digits Maximum number of digits of the numbers
+ * @tparam Limbs Base of the digits of the numbers
+ * @return x from [0, m) such that a * x = 1 (mod m)
+ */
+template<ValidDigit T, T max_digits, LimbBackend Limbs>
+MPInt<T, max_digits, Limbs> mod_inverse_euclid(const MPInt<T, max_digits, Limbs> &a,
+                                               const MPInt<T, max_digits, Limbs> &m) {
+    if (m.getSign() < 0 || m.isZero())
+        throw std::invalid_argument("Modulus has to be positive");
+    MPInt<T, max_digits, Limbs> zero(0), x1(0), x(1), r0 = m, r1 = a % m;
+    while (r1 != zero) {
+        auto q = r0 / r1;
+        auto t = r1;
+        r1 = r0 % r1;
+        r0 = t;
+        t = x;
+        x = x1 - q * x;
+        x1 = t;
+    }
+    if (r0 != MPInt<T, max_digits, Limbs>(1))
+        throw std::invalid_argument("Number is not invertible modulo the modulus");
+    return x1.getSign() < 0 ? x1 + m : x1;
+}
+
+/**
+ * Accumulator of many non-negative MPInt numbers with lazy normalization (carry save addition)
+ * Digits are added to 64 bit slots without any carry propagation, so the addition is a plain loop over the digits,
+ * which the compiler vectorizes (SIMD additions of the digits); carries are propagated once when the sum is read
+ * Every slot holds less than 2^64 after MAX_ADDITIONS additions of digits smaller than 2^32, the slots are normalized
+ * before the limit is reached
+ * @tparam max_digits Maximum number of digits of the sum (excluding the sign) (UNLIMITED is possible)
+ * @tparam Limbs Base of the digits (DecimalLimbs or BinaryLimbs)
+ */
+template<ValidDigit T, T max_digits, LimbBackend Limbs = DecimalLimbs>
+class MPIntAccumulator {
+private:
+    /** Number of additions after which the slots have to be normalized (digits are smaller than 2^32) */
+    static constexpr uint64_t MAX_ADDITIONS = UINT32_MAX;
+
+    /** Slots of the digits (the least significant first), the capacity is kept after clear() */
+    std::vector<uint64_t> mSlots;
+    /** Number of additions since the last normalization */
+    uint64_t mAdditions;
+
+    /**
+     * Propagates the carries through the slots, so every slot holds a single digit again
+     * Slot is at most (2^32 - 1) * MAX_ADDITIONS and carry is smaller than 2^32, so the sum of both fits 64 bits
+     */
+    void normalize() {
+        uint64_t carry = 0;
+        for (auto &slot : mSlots) {
+            uint64_t value = slot + carry;
+            slot = value % Limbs::BASE;
+            carry = value / Limbs::BASE;
+        }
+        while (carry) {
+            mSlots.push_back(carry % Limbs::BASE);
+            carry /= Limbs::BASE;
+        }
+        mAdditions = 1;
+    }
+
+public:
+    /**
+     * Constructor for the MPIntAccumulator class, the sum is zero
+     */
+    MPIntAccumulator() : mSlots(), mAdditions(0) {
+        // Nothing to do here :)
+    }
+
+    /**
+     * Sets the sum to zero (the slots are kept for the next sum)
+     */
+    void clear() {
+        std::fill(mSlots.begin(), mSlots.end(), 0);
+        mAdditions = 0;
+    }
+
+    /**
+     * Adds a number to the sum (no carries are propagated)
+     * @tparam max_digits_other Maximum number of digits in the number
+     * @param num Non-negative number to be added
+     */
+    template<T max_digits_other>
+    void add(const MPInt<T, max_digits_other, Limbs> &num) {
+        if (num.getSign() == -1)
+            throw std::invalid_argument("Only non-negative numbers can be accumulated");
+        if (mAdditions == MAX_ADDITIONS)
+            normalize();
+
+        const auto &digits = num.getNumber();
+        if (mSlots.size() < digits.size())
+            mSlots.resize(digits.size(), 0);
+        uint64_t *slots = mSlots.data();
+        const uint32_t *data = digits.data();
+        const size_t size = digits.size();
+        for (size_t i = 0; i < size; i++)
+            slots[i] += data[i];
+        mAdditions++;
+    }
+
+    /**
+     * Normalizes the slots and returns the sum
+     * @return Sum of all the added numbers
+     */
+    [[nodiscard]] MPInt<T, max_digits, Limbs> get() const {
+        typename MPInt<T, max_digits, Limbs>::Storage digits;
+        digits.reserve(mSlots.size() + 2);
+        uint64_t carry = 0;
+        for (auto slot : mSlots) {
+            uint64_t value = slot + carry;
+            digits.push_back(value % Limbs::BASE);
+            carry = value / Limbs::BASE;
+        }
+        while (carry) {
+            digits.push_back(carry % Limbs::BASE);
+            carry /= Limbs::BASE;
+        }
+        // Leading zeros are removed, the sum of nothing is zero
+        while (digits.size() > 1 && digits.back() == 0)
+            digits.pop_back();
+        if (digits.empty())
+            digits.push_back(0);
+        return {std::move(digits), 1};
+    }
+};
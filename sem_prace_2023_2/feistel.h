@@ -0,0 +1,242 @@
+#pragma once
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+/**
+ * Loads Feistel key from file
+ * @param key_filepath Filepath to key file
+ * @param block_size Block size in bits (output)
+ * @return Key as vector of unsigned ints
+ */
+inline std::vector<unsigned int> load_feistel_key(const std::string &key_filepath, int *block_size) {
+    std::ifstream key_file(key_filepath);
+    if (!key_file.is_open()) {
+        std::cout << "Unable to open key file " << key_filepath << std::endl;
+        return {};
+    }
+
+    // Check the format
+    std::string line;
+    std::getline(key_file, line);
+    auto key_size = 0;
+    for ([[maybe_unused]] auto &c: line) key_size++;
+    if (key_size < 0 || key_size % 4 != 0 || key_size > 32) {
+        std::cout << "Invalid key size " << key_size << std::endl;
+        return {};
+    }
+
+    // Check the format of all lines
+    while (std::getline(key_file, line)) {
+        auto key_size_tmp = 0;
+        std::vector<int> key;
+        for ([[maybe_unused]] auto &c: line) key_size_tmp++;
+
+        if (key_size_tmp < 0 || key_size_tmp % 4 != 0 || key_size_tmp > 32 || key_size_tmp != key_size) {
+            std::cout << "Invalid key size " << key_size_tmp << std::endl;
+            return {};
+        }
+    }
+
+    // "Return" block size as key size * 2 (left and right parts of block) (in bits)
+    *block_size = key_size * 2;
+
+    // Return to the beginning of the file
+    key_file.clear();
+    key_file.seekg(0);
+
+    std::vector<unsigned int> key;
+    while (std::getline(key_file, line)) {
+        unsigned int tmp = 0;
+        for (auto &c: line) {
+            if (c == '0')
+                tmp = tmp << 1;
+            else if (c == '1')
+                tmp = (tmp << 1) | 1;
+            else {
+                std::cout << "Invalid key character " << c << std::endl;
+                return {};
+            }
+        }
+        key.push_back(tmp);
+    }
+
+    return key;
+}
+
+/**
+ * Saves Feistel key to file (the same format load_feistel_key() reads - one subkey per line, written in bits)
+ * @param key_filepath Filepath to key file
+ * @param key Key as vector of unsigned ints
+ * @param block_size Block size in bits
+ * @return True if the key was written, false otherwise
+ */
+inline bool save_feistel_key(const std::string &key_filepath, const std::vector<unsigned int> &key, int block_size) {
+    std::ofstream key_file(key_filepath);
+    if (!key_file.is_open()) {
+        std::cout << "Unable to open key file " << key_filepath << std::endl;
+        return false;
+    }
+
+    for (size_t i = 0; i < key.size(); i++) {
+        for (int j = block_size / 2 - 1; j >= 0; j--)
+            key_file << (key[i] & (1u << j) ? '1' : '0');
+        if (i != key.size() - 1)
+            key_file << std::endl;
+    }
+
+    return true;
+}
+
+/**
+ * Feistel encoding/decoding of the input bytes with already loaded key
+ * Input is padded with zeros to the multiple of the block size, trailing zeros are NOT removed after decoding
+ * @param input_bytes Input bytes
+ * @param key Key as vector of unsigned ints (subkey for every round)
+ * @param block_size_bits Block size in bits
+ * @param encode Flag indicating whether to encode or decode
+ * @return Output bytes
+ */
+inline std::vector<unsigned char> feistel_transform(const std::vector<unsigned char> &input_bytes,
+                                                    std::vector<unsigned int> key, int block_size_bits, bool encode) {
+    // Pad input bytes with zeros to make it a multiple of block size (in bytes)
+    std::vector<unsigned char> input_bytes_padded;
+    input_bytes_padded.insert(input_bytes_padded.end(), input_bytes.begin(), input_bytes.end());
+    while (input_bytes_padded.size() % (block_size_bits / 8)) // block_size_bits / 8 = block size in bytes
+        input_bytes_padded.push_back(0x00);
+
+    if (!encode)
+        std::reverse(key.begin(), key.end()); // Reverse key for decoding
+
+    std::vector<unsigned char> output_bytes;
+
+    // Iterate over all blocks of input bytes
+    for (size_t i = 0; i < input_bytes_padded.size() * 8; i += block_size_bits) {
+        unsigned int left = 0;
+        unsigned int right = 0;
+        for (int j = 0; j < block_size_bits / 2; j++) { // Accumulate left and right parts of block
+            left = (left << 1) | (input_bytes_padded[i / 8 + j / 8] & (1 << (7 - j % 8)) ? 1 : 0);
+            right = right << 1 | (input_bytes_padded[i / 8 + (j + block_size_bits / 2) / 8] &
+                                  (1 << (7 - (j + block_size_bits / 2) % 8)) ? 1 : 0);
+        }
+
+        // Perform Feistel rounds
+        for (unsigned int subkey: key) {
+            unsigned int tmp = left;
+            left = right;
+            right = tmp ^ ((right ^ subkey) & subkey);
+        }
+
+        // Write output bits
+        std::vector<unsigned char> output_bits;
+        for (int j = block_size_bits / 2 - 1; j >= 0; j--)
+            output_bits.push_back(right & (1 << j) ? 0x01 : 0x00); // Right first for the final swap
+        for (int j = block_size_bits / 2 - 1; j >= 0; j--)
+            output_bits.push_back(left & (1 << j) ? 0x01 : 0x00); // Left second because of the final swap
+
+        // Convert output bits to bytes
+        for (int j = 0; j < output_bits.size(); j += 8) {
+            unsigned char byte = 0;
+            for (int k = 0; k < 8; k++)
+                byte = (byte << 1) | output_bits[j + k];
+            output_bytes.push_back(byte);
+        }
+    }
+
+    return output_bytes;
+}
+
+/**
+ * Feistel encoding/decoding of whole blocks in place
+ * Every block is read as one big endian word (block is at most 64 bits), its upper half is the left part and its
+ * lower half is the right part - the same bit order the bit by bit feistel_transform() uses
+ * @param bytes Bytes to transform (size has to be a multiple of the block size in bytes)
+ * @param size Number of bytes
+ * @param key Key as vector of unsigned ints (already reversed for decoding)
+ * @param block_size_bits Block size in bits
+ */
+inline void feistel_blocks_in_place(unsigned char *bytes, size_t size, const std::vector<unsigned int> &key,
+                                    int block_size_bits) {
+    const int block_size_bytes = block_size_bits / 8;
+    const int half_size = block_size_bits / 2;
+    const uint64_t half_mask = (1ull << half_size) - 1;
+
+    for (size_t i = 0; i + block_size_bytes <= size; i += block_size_bytes) {
+        uint64_t block = 0;
+        for (int j = 0; j < block_size_bytes; j++)
+            block = (block << 8) | bytes[i + j];
+
+        auto left = static_cast<unsigned int>(block >> half_size);
+        auto right = static_cast<unsigned int>(block & half_mask);
+        for (unsigned int subkey: key) {
+            unsigned int tmp = left;
+            left = right;
+            right = tmp ^ ((right ^ subkey) & subkey);
+        }
+
+        block = (static_cast<uint64_t>(right) << half_size) | left; // Final swap
+        for (int j = block_size_bytes - 1; j >= 0; j--) {
+            bytes[i + j] = static_cast<unsigned char>(block);
+            block >>= 8;
+        }
+    }
+}
+
+/**
+ * Feistel encoding/decoding of the input bytes with already loaded key, word based variant of feistel_transform()
+ * @param input_bytes Input bytes
+ * @param key Key as vector of unsigned ints (subkey for every round)
+ * @param block_size_bits Block size in bits
+ * @param encode Flag indicating whether to encode or decode
+ * @return Output bytes
+ */
+inline std::vector<unsigned char> feistel_transform_words(const std::vector<unsigned char> &input_bytes,
+                                                          std::vector<unsigned int> key, int block_size_bits,
+                                                          bool encode) {
+    std::vector<unsigned char> output_bytes{input_bytes};
+    while (output_bytes.size() % (block_size_bits / 8))
+        output_bytes.push_back(0x00);
+
+    if (!encode)
+        std::reverse(key.begin(), key.end()); // Reverse key for decoding
+
+    feistel_blocks_in_place(output_bytes.data(), output_bytes.size(), key, block_size_bits);
+    return output_bytes;
+}
+
+/**
+ * Feistel encoding/decoding
+ * @param input_bytes Input bytes
+ * @param encode Flag indicating whether to encode or decode
+ * @param key_filepath Filepath to key file
+ * @return Output bytes
+ */
+inline std::vector<unsigned char> perform_feistel(const std::vector<unsigned char> &input_bytes, bool encode,
+                                                  const std::string &key_filepath = "keys.txt") {
+    int block_size_bits = 0;
+    std::vector<unsigned int> key = load_feistel_key(key_filepath, &block_size_bits);
+    if (key.empty()) // If key format is invalid, return empty vector
+        return {};
+
+    if (encode) {
+        std::cout << "Key has been loaded. Performing encoding... Block size = " << block_size_bits << " bits"
+                  << std::endl;
+    } else {
+        std::cout << "Key has been loaded. Performing decoding... Block size = " << block_size_bits << " bits"
+                  << std::endl;
+    }
+
+    auto output_bytes = feistel_transform(input_bytes, key, block_size_bits, encode);
+
+    // Remove trailing zeros if decoding (they were added for padding)
+    if (!encode) {
+        while (!output_bytes.back())
+            output_bytes.pop_back();
+    }
+
+    return output_bytes;
+}
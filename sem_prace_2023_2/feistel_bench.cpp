@@ -0,0 +1,226 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdlib>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "allocation_counter.h"
+#include "feistel.h"
+
+/** Block widths swept by default (in bits) */
+constexpr int BLOCK_SIZES[] = {8, 16, 24, 32, 40, 48, 56, 64};
+/** Round counts swept by default */
+constexpr int ROUNDS[] = {1, 4, 16};
+/** Smallest input size (in bytes) */
+constexpr uint64_t MIN_INPUT_SIZE = 1024;
+/** Largest input size allowed (in bytes) */
+constexpr uint64_t MAX_INPUT_SIZE = 4ull * 1024 * 1024 * 1024;
+/** Default largest input size of the sweep (in bytes), bigger sizes have to be asked for explicitly */
+constexpr uint64_t DEFAULT_MAX_INPUT_SIZE = 1024 * 1024;
+/** Minimal measured time of one configuration (in seconds) */
+constexpr double MIN_TIME = 0.2;
+
+/**
+ * Feistel engine - implementation of the Feistel transformation over the whole input with already loaded key
+ */
+struct FeistelEngine {
+    /** Name of the engine (written to the results) */
+    const char *name;
+    /** Transformation (input bytes, key, block size in bits, encode flag) */
+    std::vector<unsigned char> (*transform)(const std::vector<unsigned char> &, std::vector<unsigned int>, int, bool);
+};
+
+/** All engines that are benchmarked */
+const FeistelEngine ENGINES[] = {
+        {"reference", feistel_transform},
+        {"words", feistel_transform_words},
+};
+
+/**
+ * Result of one benchmarked configuration
+ */
+struct BenchResult {
+    /** Name of the engine */
+    std::string engine;
+    /** Block size in bits */
+    int block_size_bits;
+    /** Number of rounds */
+    int rounds;
+    /** Input size in bytes */
+    uint64_t input_size;
+    /** Number of repetitions */
+    int repetitions;
+    /** Time of one repetition in seconds */
+    double seconds;
+    /** Throughput in MB/s (1 MB = 10^6 B) */
+    double mb_per_s;
+    /** CPU cycles per byte (0 if the cycle counter is not available) */
+    double cycles_per_byte;
+    /** Allocations per MB of the input */
+    double allocations_per_mb;
+};
+
+/**
+ * Reads the time stamp counter (if available)
+ * @return Number of cycles, 0 if the counter is not available
+ */
+uint64_t read_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/**
+ * Benchmarks one configuration
+ * Encoding is repeated until MIN_TIME elapses (at least once)
+ * @param engine Engine
+ * @param input_bytes Input bytes
+ * @param key Key
+ * @param block_size_bits Block size in bits
+ * @param min_time Minimal measured time in seconds
+ * @return Result of the benchmark
+ */
+BenchResult bench(const FeistelEngine &engine, const std::vector<unsigned char> &input_bytes,
+                  const std::vector<unsigned int> &key, int block_size_bits, double min_time) {
+    int repetitions = 0;
+    uint64_t cycles = 0;
+    uint64_t allocations = 0;
+    std::chrono::duration<double> elapsed{0};
+
+    do {
+        auto allocations_before = allocation_count();
+        auto cycles_before = read_cycles();
+        auto start = std::chrono::steady_clock::now();
+        auto output_bytes = engine.transform(input_bytes, key, block_size_bits, true);
+        auto end = std::chrono::steady_clock::now();
+        cycles += read_cycles() - cycles_before;
+        allocations += allocation_count() - allocations_before;
+        elapsed += end - start;
+        repetitions++;
+        if (output_bytes.size() < input_bytes.size())
+            std::cerr << "Engine " << engine.name << " returned too few bytes" << std::endl;
+    } while (elapsed.count() < min_time);
+
+    auto bytes = static_cast<double>(input_bytes.size()) * repetitions;
+    return {
+            engine.name,
+            block_size_bits,
+            static_cast<int>(key.size()),
+            input_bytes.size(),
+            repetitions,
+            elapsed.count() / repetitions,
+            bytes / elapsed.count() / 1e6,
+            static_cast<double>(cycles) / bytes,
+            static_cast<double>(allocations) / (bytes / 1e6)
+    };
+}
+
+/**
+ * Writes results as CSV
+ * @param os Output stream
+ * @param results Results
+ */
+void write_csv(std::ostream &os, const std::vector<BenchResult> &results) {
+    os << "engine,block_size_bits,rounds,input_size,repetitions,seconds,mb_per_s,cycles_per_byte,allocations_per_mb"
+       << std::endl;
+    for (auto &r: results)
+        os << r.engine << "," << r.block_size_bits << "," << r.rounds << "," << r.input_size << ","
+           << r.repetitions << "," << r.seconds << "," << r.mb_per_s << "," << r.cycles_per_byte << ","
+           << r.allocations_per_mb << std::endl;
+}
+
+/**
+ * Writes results as JSON
+ * @param os Output stream
+ * @param results Results
+ */
+void write_json(std::ostream &os, const std::vector<BenchResult> &results) {
+    os << "[" << std::endl;
+    for (size_t i = 0; i < results.size(); i++) {
+        auto &r = results[i];
+        os << "  {\"engine\": \"" << r.engine << "\", \"block_size_bits\": " << r.block_size_bits
+           << ", \"rounds\": " << r.rounds << ", \"input_size\": " << r.input_size
+           << ", \"repetitions\": " << r.repetitions << ", \"seconds\": " << r.seconds
+           << ", \"mb_per_s\": " << r.mb_per_s << ", \"cycles_per_byte\": " << r.cycles_per_byte
+           << ", \"allocations_per_mb\": " << r.allocations_per_mb << "}" << (i + 1 < results.size() ? "," : "")
+           << std::endl;
+    }
+    os << "]" << std::endl;
+}
+
+/**
+ * Main function
+ * Usage: feistel_bench [--max-size <bytes>] [--min-time <seconds>] [--json] [--output <file>]
+ * @return 0 if successful
+ */
+int main(int argc, char **argv) {
+    uint64_t max_size = DEFAULT_MAX_INPUT_SIZE;
+    double min_time = MIN_TIME;
+    bool json = false;
+    std::string output_filepath;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--max-size" && i + 1 < argc)
+            max_size = std::stoull(argv[++i]);
+        else if (arg == "--min-time" && i + 1 < argc)
+            min_time = std::stod(argv[++i]);
+        else if (arg == "--json")
+            json = true;
+        else if (arg == "--output" && i + 1 < argc)
+            output_filepath = argv[++i];
+        else {
+            std::cout << "Usage: " << argv[0]
+                      << " [--max-size <bytes>] [--min-time <seconds>] [--json] [--output <file>]" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    max_size = std::clamp(max_size, MIN_INPUT_SIZE, MAX_INPUT_SIZE);
+
+    // Random data and keys are generated with a fixed seed, so all builds benchmark the same input
+    std::mt19937_64 gen(42);
+    std::vector<BenchResult> results;
+
+    // Input sizes grow by the factor of 16 and always end with the largest size
+    std::vector<uint64_t> input_sizes;
+    for (uint64_t input_size = MIN_INPUT_SIZE; input_size < max_size; input_size *= 16)
+        input_sizes.push_back(input_size);
+    input_sizes.push_back(max_size);
+
+    for (uint64_t input_size: input_sizes) {
+        std::vector<unsigned char> input_bytes(input_size);
+        for (auto &byte: input_bytes)
+            byte = static_cast<unsigned char>(gen());
+
+        for (int block_size_bits: BLOCK_SIZES) {
+            for (int rounds: ROUNDS) {
+                std::vector<unsigned int> key(rounds);
+                for (auto &subkey: key)
+                    subkey = static_cast<unsigned int>(gen() & ((1ull << (block_size_bits / 2)) - 1));
+
+                for (auto &engine: ENGINES) {
+                    results.push_back(bench(engine, input_bytes, key, block_size_bits, min_time));
+                    auto &r = results.back();
+                    std::cerr << r.engine << " block " << r.block_size_bits << " bits, " << r.rounds << " rounds, "
+                              << r.input_size << " B: " << r.mb_per_s << " MB/s, " << r.cycles_per_byte
+                              << " cycles/B, " << r.allocations_per_mb << " allocations/MB" << std::endl;
+                }
+            }
+        }
+    }
+
+    if (output_filepath.empty()) {
+        json ? write_json(std::cout, results) : write_csv(std::cout, results);
+    } else {
+        std::ofstream output(output_filepath);
+        json ? write_json(output, results) : write_csv(output, results);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,331 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <cstring>
+#include <cstdint>
+#include "feistel.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/** Size of one chunk of the file that is transformed and journaled at once (in bytes) */
+constexpr uint64_t CHUNK_SIZE = 64 * 1024 * 1024;
+/** Magic bytes of the padding trailer appended to the encoded file */
+constexpr char TRAILER_MAGIC[8] = {'F', 'E', 'I', 'S', 'T', 'P', 'A', 'D'};
+/** Magic bytes of the journal file */
+constexpr char JOURNAL_MAGIC[8] = {'F', 'E', 'I', 'S', 'T', 'J', 'R', 'N'};
+/** Suffix of the journal file (journal is stored next to the transformed file) */
+constexpr std::string_view JOURNAL_SUFFIX = ".journal";
+
+/**
+ * Trailer appended to the end of the encoded file
+ * Encoded file is padded with zeros to the multiple of the block size, trailer holds the original size
+ */
+struct InPlaceTrailer {
+    /** TRAILER_MAGIC */
+    char magic[8];
+    /** Size of the file before encoding (in bytes) */
+    uint64_t original_size;
+};
+
+/**
+ * Header of the journal file
+ * Journal holds the progress of the transformation and the backup of the chunk being transformed
+ * (backup bytes follow right after the header), so the transformation can be resumed after a crash
+ */
+struct InPlaceJournal {
+    /** JOURNAL_MAGIC */
+    char magic[8];
+    /** 1 if encoding, 0 if decoding */
+    uint32_t encode;
+    /** Block size in bits */
+    uint32_t block_size_bits;
+    /** Size of the file before encoding (in bytes) */
+    uint64_t original_size;
+    /** Size of the transformed data (multiple of the block size) (in bytes) */
+    uint64_t padded_size;
+    /** Size of one chunk (in bytes) */
+    uint64_t chunk_size;
+    /** Index of the first chunk that was not transformed yet */
+    uint64_t next_chunk;
+    /** Index of the chunk being transformed right now (its backup is in the journal), -1 if none */
+    int64_t in_progress;
+};
+
+/**
+ * Writes the whole buffer at the given offset
+ * @param fd File descriptor
+ * @param data Data
+ * @param size Size of the data
+ * @param offset Offset in the file
+ * @return True if everything was written, false otherwise
+ */
+inline bool pwrite_all(int fd, const void *data, size_t size, off_t offset) {
+    auto *ptr = static_cast<const unsigned char *>(data);
+    while (size) {
+        auto written = pwrite(fd, ptr, size, offset);
+        if (written <= 0)
+            return false;
+        ptr += written;
+        size -= written;
+        offset += written;
+    }
+    return true;
+}
+
+/**
+ * Reads the whole buffer from the given offset
+ * @param fd File descriptor
+ * @param data Output buffer
+ * @param size Size of the data
+ * @param offset Offset in the file
+ * @return True if everything was read, false otherwise
+ */
+inline bool pread_all(int fd, void *data, size_t size, off_t offset) {
+    auto *ptr = static_cast<unsigned char *>(data);
+    while (size) {
+        auto read_bytes = pread(fd, ptr, size, offset);
+        if (read_bytes <= 0)
+            return false;
+        ptr += read_bytes;
+        size -= read_bytes;
+        offset += read_bytes;
+    }
+    return true;
+}
+
+/**
+ * Writes the journal header and flushes it to the disk
+ * @param fd File descriptor of the journal
+ * @param journal Journal header
+ * @return True if successful, false otherwise
+ */
+inline bool write_journal(int fd, const InPlaceJournal &journal) {
+    return pwrite_all(fd, &journal, sizeof(journal), 0) && fsync(fd) == 0;
+}
+
+/**
+ * Transforms the mapped bytes with all available threads (every thread gets a range of whole blocks)
+ * @param bytes Mapped bytes
+ * @param size Number of bytes (multiple of the block size in bytes)
+ * @param key Key (already reversed for decoding)
+ * @param block_size_bits Block size in bits
+ */
+inline void feistel_parallel(unsigned char *bytes, uint64_t size, const std::vector<unsigned int> &key,
+                             int block_size_bits) {
+    const uint64_t block_size_bytes = block_size_bits / 8;
+    const uint64_t blocks = size / block_size_bytes;
+    const uint64_t thread_count = std::max(1u, std::thread::hardware_concurrency());
+    const uint64_t blocks_per_thread = (blocks + thread_count - 1) / thread_count;
+
+    std::vector<std::thread> threads;
+    for (uint64_t start = 0; start < blocks; start += blocks_per_thread) {
+        auto count = std::min(blocks_per_thread, blocks - start);
+        threads.emplace_back(feistel_blocks_in_place, bytes + start * block_size_bytes, count * block_size_bytes,
+                             std::cref(key), block_size_bits);
+    }
+    for (auto &thread: threads)
+        thread.join();
+}
+
+/**
+ * Feistel encoding/decoding of a file in place (the file is memory mapped, no second copy of the file is created)
+ * Encoding pads the file with zeros to the multiple of the block size and appends InPlaceTrailer with the original
+ * size, decoding reads the trailer and truncates the file back to the original size
+ * Progress is journaled in <filepath>.journal chunk by chunk, every chunk is backed up to the journal before it is
+ * transformed - if the program crashes, the next run with the same parameters restores the unfinished chunk and
+ * continues with it
+ * @param filepath Filepath of the file to transform
+ * @param encode Flag indicating whether to encode or decode
+ * @param key_filepath Filepath to key file
+ * @return True if successful, false otherwise
+ */
+inline bool feistel_in_place(const std::string &filepath, bool encode, const std::string &key_filepath = "keys.txt") {
+    int block_size_bits = 0;
+    std::vector<unsigned int> key = load_feistel_key(key_filepath, &block_size_bits);
+    if (key.empty()) // If key format is invalid, there is nothing to do
+        return false;
+    if (!encode)
+        std::reverse(key.begin(), key.end()); // Reverse key for decoding
+    const uint64_t block_size_bytes = block_size_bits / 8;
+
+    int fd = open(filepath.c_str(), O_RDWR);
+    if (fd < 0) {
+        std::cout << "Unable to open file " << filepath << std::endl;
+        return false;
+    }
+    struct stat file_stat{};
+    fstat(fd, &file_stat);
+    uint64_t file_size = file_stat.st_size;
+
+    // Load the journal of the interrupted run or start a new one
+    auto journal_filepath = filepath + std::string(JOURNAL_SUFFIX);
+    InPlaceJournal journal{};
+    int journal_fd = open(journal_filepath.c_str(), O_RDWR);
+    if (journal_fd >= 0) {
+        if (!pread_all(journal_fd, &journal, sizeof(journal), 0) ||
+            std::memcmp(journal.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0 ||
+            journal.encode != encode || journal.block_size_bits != static_cast<uint32_t>(block_size_bits)) {
+            std::cout << "Journal " << journal_filepath << " belongs to a different operation" << std::endl;
+            close(journal_fd);
+            close(fd);
+            return false;
+        }
+        std::cout << "Resuming interrupted " << (encode ? "encoding" : "decoding") << " from chunk "
+                  << journal.next_chunk << std::endl;
+
+        // Restore the chunk that was being transformed when the program crashed
+        if (journal.in_progress >= 0) {
+            auto offset = journal.in_progress * journal.chunk_size;
+            auto size = std::min(journal.chunk_size, journal.padded_size - offset);
+            std::vector<unsigned char> backup(size);
+            if (!pread_all(journal_fd, backup.data(), size, sizeof(journal)) ||
+                !pwrite_all(fd, backup.data(), size, static_cast<off_t>(offset)) || fsync(fd) != 0) {
+                std::cout << "Unable to restore chunk " << journal.in_progress << std::endl;
+                close(journal_fd);
+                close(fd);
+                return false;
+            }
+            journal.in_progress = -1;
+            if (!write_journal(journal_fd, journal)) {
+                std::cout << "Unable to write journal " << journal_filepath << std::endl;
+                close(journal_fd);
+                close(fd);
+                return false;
+            }
+        }
+    } else {
+        std::memcpy(journal.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+        journal.encode = encode;
+        journal.block_size_bits = block_size_bits;
+        journal.chunk_size = CHUNK_SIZE / block_size_bytes * block_size_bytes;
+        journal.next_chunk = 0;
+        journal.in_progress = -1;
+
+        if (encode) {
+            journal.original_size = file_size;
+            journal.padded_size = (file_size + block_size_bytes - 1) / block_size_bytes * block_size_bytes;
+        } else {
+            InPlaceTrailer trailer{};
+            if (file_size < sizeof(trailer) || !pread_all(fd, &trailer, sizeof(trailer), file_size - sizeof(trailer)) ||
+                std::memcmp(trailer.magic, TRAILER_MAGIC, sizeof(TRAILER_MAGIC)) != 0 ||
+                (file_size - sizeof(trailer)) % block_size_bytes != 0) {
+                std::cout << "File " << filepath << " was not encoded in place" << std::endl;
+                close(fd);
+                return false;
+            }
+            journal.original_size = trailer.original_size;
+            journal.padded_size = file_size - sizeof(trailer);
+        }
+
+        journal_fd = open(journal_filepath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (journal_fd < 0 || !write_journal(journal_fd, journal)) {
+            std::cout << "Unable to create journal " << journal_filepath << std::endl;
+            close(fd);
+            return false;
+        }
+    }
+
+    // Padding and trailer are written before any chunk is transformed (writing them again on resume is harmless)
+    if (encode && file_size != journal.padded_size + sizeof(InPlaceTrailer)) {
+        InPlaceTrailer trailer{};
+        std::memcpy(trailer.magic, TRAILER_MAGIC, sizeof(TRAILER_MAGIC));
+        trailer.original_size = journal.original_size;
+        if (ftruncate(fd, static_cast<off_t>(journal.padded_size + sizeof(trailer))) != 0 ||
+            !pwrite_all(fd, &trailer, sizeof(trailer), static_cast<off_t>(journal.padded_size)) || fsync(fd) != 0) {
+            std::cout << "Unable to write padding of " << filepath << std::endl;
+            close(journal_fd);
+            close(fd);
+            return false;
+        }
+    }
+
+    std::cout << "Key has been loaded. Performing in place " << (encode ? "encoding" : "decoding")
+              << "... Block size = " << block_size_bits << " bits" << std::endl;
+
+    const uint64_t chunk_count = (journal.padded_size + journal.chunk_size - 1) / journal.chunk_size;
+    if (journal.next_chunk < chunk_count) {
+        void *mapping = mmap(nullptr, journal.padded_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (mapping == MAP_FAILED) {
+            std::cout << "Unable to map file " << filepath << std::endl;
+            close(journal_fd);
+            close(fd);
+            return false;
+        }
+        auto *bytes = static_cast<unsigned char *>(mapping);
+        madvise(mapping, journal.padded_size, MADV_SEQUENTIAL);
+
+        for (uint64_t chunk = journal.next_chunk; chunk < chunk_count; chunk++) {
+            auto offset = chunk * journal.chunk_size;
+            auto size = std::min(journal.chunk_size, journal.padded_size - offset);
+            if (chunk + 1 < chunk_count) // Let the kernel read the next chunk while this one is transformed
+                madvise(bytes + offset + size, std::min(journal.chunk_size, journal.padded_size - offset - size),
+                        MADV_WILLNEED);
+
+            // Back up the chunk first, only then mark it as being transformed
+            journal.in_progress = static_cast<int64_t>(chunk);
+            if (!pwrite_all(journal_fd, bytes + offset, size, sizeof(journal)) || fdatasync(journal_fd) != 0 ||
+                !write_journal(journal_fd, journal)) {
+                std::cout << "Unable to write journal " << journal_filepath << std::endl;
+                munmap(mapping, journal.padded_size);
+                close(journal_fd);
+                close(fd);
+                return false;
+            }
+
+            feistel_parallel(bytes + offset, size, key, block_size_bits);
+            if (msync(bytes + offset, size, MS_SYNC) != 0) {
+                std::cout << "Unable to flush chunk " << chunk << " of " << filepath << std::endl;
+                munmap(mapping, journal.padded_size);
+                close(journal_fd);
+                close(fd);
+                return false;
+            }
+
+            // The chunk is marked as done only after it is on the disk, otherwise the journal keeps its backup
+            journal.next_chunk = chunk + 1;
+            journal.in_progress = -1;
+            if (!write_journal(journal_fd, journal)) {
+                std::cout << "Unable to write journal " << journal_filepath << std::endl;
+                munmap(mapping, journal.padded_size);
+                close(journal_fd);
+                close(fd);
+                return false;
+            }
+        }
+
+        munmap(mapping, journal.padded_size);
+    }
+
+    // Decoding removes the padding and the trailer
+    if (!encode && (ftruncate(fd, static_cast<off_t>(journal.original_size)) != 0 || fsync(fd) != 0)) {
+        std::cout << "Unable to remove padding of " << filepath << std::endl;
+        close(journal_fd);
+        close(fd);
+        return false;
+    }
+
+    close(journal_fd);
+    close(fd);
+    unlink(journal_filepath.c_str());
+    return true;
+}
+#else
+/**
+ * In place transformation needs POSIX mmap, it is not available on this platform
+ * @param filepath Filepath of the file to transform
+ * @param encode Flag indicating whether to encode or decode
+ * @param key_filepath Filepath to key file
+ * @return Always false
+ */
+inline bool feistel_in_place(const std::string &filepath, bool encode, const std::string &key_filepath = "keys.txt") {
+    std::cout << "In place mode is not supported on this platform" << std::endl;
+    return false;
+}
+#endif
@@ -0,0 +1,283 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include "feistel.h"
+
+/** Default file the recovered key is written to */
+constexpr std::string_view RECOVERED_KEY_FILE = "recovered_keys.txt";
+/** Maximum number of rounds tried when the round count is not given */
+constexpr int MAX_ROUNDS = 64;
+/** Identity permutation of the four bit slice states (state s is stored at bits 2 * s and 2 * s + 1) */
+constexpr unsigned char IDENTITY = 0b11100100;
+
+/*
+ * The round function right = left ^ ((right ^ subkey) & subkey) only uses bitwise operations, so the bit j of the
+ * output depends on the bit j of left, right and subkey only
+ * The whole cipher thus falls apart into block_size / 2 independent 2 bit Feistel networks (bit slices)
+ * State of a bit slice is (l << 1) | r and every round is a permutation of these four states chosen by the key bit:
+ * key bit 0 -> (l, r) becomes (r, l)
+ * key bit 1 -> (l, r) becomes (r, l ^ !r)
+ * A key schedule of a bit slice is therefore just a word over two permutations of four elements and all the words
+ * of the given length form at most 4! = 24 different permutations - the search is done on these, not on the keys
+ * GF(2) elimination is of no use here, because the AND in the round function makes the cipher non linear
+ */
+
+/**
+ * Returns the state the permutation maps the given state to
+ * @param perm Permutation of the four states
+ * @param state State (0 - 3)
+ * @return Mapped state
+ */
+int perm_apply(unsigned char perm, int state) {
+    return (perm >> (2 * state)) & 0b11;
+}
+
+/**
+ * Returns permutation of one round with the given key bit
+ * @param key_bit Key bit of the bit slice
+ * @return Permutation of the four states
+ */
+unsigned char round_perm(bool key_bit) {
+    unsigned char res = 0;
+    for (int state = 0; state < 4; state++) {
+        int l = state >> 1, r = state & 1;
+        int new_l = r, new_r = l ^ (key_bit & !r);
+        res |= ((new_l << 1) | new_r) << (2 * state);
+    }
+    return res;
+}
+
+/**
+ * Composes two permutations (first is applied first)
+ * @param first First permutation
+ * @param second Second permutation
+ * @return Composed permutation
+ */
+unsigned char perm_compose(unsigned char first, unsigned char second) {
+    unsigned char res = 0;
+    for (int state = 0; state < 4; state++)
+        res |= perm_apply(second, perm_apply(first, state)) << (2 * state);
+    return res;
+}
+
+/**
+ * One level of the search - every permutation reachable by key words of the given length
+ * For every reachable permutation the permutation of the previous level and the key bit are stored (for backtracking)
+ */
+struct ReachableLevel {
+    /** Flag whether the permutation is reachable */
+    std::array<bool, 256> reachable{};
+    /** Permutation of the previous level */
+    std::array<unsigned char, 256> previous{};
+    /** Key bit of the last round */
+    std::array<bool, 256> key_bit{};
+};
+
+/**
+ * Generates all levels of reachable permutations up to the given number of rounds
+ * @param rounds Number of rounds
+ * @return Vector of levels (index is the number of rounds)
+ */
+std::vector<ReachableLevel> gen_reachable_levels(int rounds) {
+    std::vector<ReachableLevel> levels(rounds + 1);
+    levels[0].reachable[IDENTITY] = true;
+    const unsigned char round_perms[2] = {round_perm(false), round_perm(true)};
+
+    for (int i = 0; i < rounds; i++) {
+        for (int perm = 0; perm < 256; perm++) {
+            if (!levels[i].reachable[perm])
+                continue;
+            for (int bit = 0; bit < 2; bit++) {
+                auto next = perm_compose(perm, round_perms[bit]);
+                if (levels[i + 1].reachable[next])
+                    continue;
+                levels[i + 1].reachable[next] = true;
+                levels[i + 1].previous[next] = perm;
+                levels[i + 1].key_bit[next] = bit;
+            }
+        }
+    }
+
+    return levels;
+}
+
+/**
+ * Splits bytes into blocks and returns left and right parts of every block
+ * (the same bit order perform_feistel() uses, bytes are padded with zeros)
+ * @param bytes Input bytes
+ * @param block_size_bits Block size in bits
+ * @return Vector of (left, right) pairs
+ */
+std::vector<std::pair<unsigned int, unsigned int>> split_blocks(const std::vector<unsigned char> &bytes,
+                                                                int block_size_bits) {
+    std::vector<unsigned char> bytes_padded{bytes};
+    while (bytes_padded.size() % (block_size_bits / 8))
+        bytes_padded.push_back(0x00);
+
+    std::vector<std::pair<unsigned int, unsigned int>> res;
+    for (size_t i = 0; i < bytes_padded.size() * 8; i += block_size_bits) {
+        unsigned int left = 0;
+        unsigned int right = 0;
+        for (int j = 0; j < block_size_bits / 2; j++) {
+            left = (left << 1) | (bytes_padded[i / 8 + j / 8] & (1 << (7 - j % 8)) ? 1 : 0);
+            right = right << 1 | (bytes_padded[i / 8 + (j + block_size_bits / 2) / 8] &
+                                  (1 << (7 - (j + block_size_bits / 2) % 8)) ? 1 : 0);
+        }
+        res.emplace_back(left, right);
+    }
+    return res;
+}
+
+/**
+ * Reads whole file binary
+ * @param filepath Filepath
+ * @return File bytes
+ */
+std::vector<unsigned char> read_file(const std::string &filepath) {
+    std::vector<unsigned char> res;
+    std::ifstream input(filepath, std::ios::binary);
+    std::copy(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>(), std::back_inserter(res));
+    return res;
+}
+
+/**
+ * Recovers a key schedule (with the given number of rounds) that maps the plaintext blocks to the ciphertext blocks
+ * @param plain_blocks Plaintext blocks (left, right)
+ * @param cipher_blocks Ciphertext blocks (first half, second half) in the same order
+ * @param block_size_bits Block size in bits
+ * @param rounds Number of rounds, 0 means the smallest number of rounds that fits is searched for
+ * @param underdetermined Number of bit slices that were not fully determined by the given blocks (output)
+ * @return Recovered key, empty if there is no such key
+ */
+std::vector<unsigned int> recover_key(const std::vector<std::pair<unsigned int, unsigned int>> &plain_blocks,
+                                      const std::vector<std::pair<unsigned int, unsigned int>> &cipher_blocks,
+                                      int block_size_bits, int rounds, int *underdetermined) {
+    const int half_size = block_size_bits / 2;
+
+    // Collect the observed mapping of states for every bit slice (-1 = state was never seen)
+    std::vector<std::array<int, 4>> observed(half_size, {-1, -1, -1, -1});
+    auto blocks = std::min(plain_blocks.size(), cipher_blocks.size());
+    for (size_t i = 0; i < blocks; i++) {
+        for (int j = 0; j < half_size; j++) {
+            int in = (((plain_blocks[i].first >> j) & 1) << 1) | ((plain_blocks[i].second >> j) & 1);
+            // Output is written right first (final swap), so the second half of the ciphertext is the left part
+            int out = (((cipher_blocks[i].second >> j) & 1) << 1) | ((cipher_blocks[i].first >> j) & 1);
+            if (observed[j][in] != -1 && observed[j][in] != out) {
+                std::cout << "Blocks are not consistent with any Feistel key (bit " << j << ")" << std::endl;
+                return {};
+            }
+            observed[j][in] = out;
+        }
+    }
+
+    *underdetermined = 0;
+    for (auto &slice: observed)
+        if (std::count(slice.begin(), slice.end(), -1) > 1) // Three known states determine the fourth one
+            (*underdetermined)++;
+
+    auto max_rounds = rounds ? rounds : MAX_ROUNDS;
+    auto levels = gen_reachable_levels(max_rounds);
+
+    for (int r = rounds ? rounds : 1; r <= max_rounds; r++) {
+        // Find a reachable permutation consistent with the observations for every bit slice
+        std::vector<unsigned char> chosen(half_size);
+        bool found_all = true;
+        for (int j = 0; j < half_size && found_all; j++) {
+            bool found = false;
+            for (int perm = 0; perm < 256 && !found; perm++) {
+                if (!levels[r].reachable[perm])
+                    continue;
+                found = true;
+                for (int state = 0; state < 4; state++)
+                    if (observed[j][state] != -1 && perm_apply(perm, state) != observed[j][state])
+                        found = false;
+                if (found)
+                    chosen[j] = perm;
+            }
+            found_all = found;
+        }
+        if (!found_all)
+            continue;
+
+        // Backtrack key bits of every bit slice
+        std::vector<unsigned int> key(r, 0);
+        for (int j = 0; j < half_size; j++) {
+            unsigned char perm = chosen[j];
+            for (int i = r; i > 0; i--) {
+                if (levels[i].key_bit[perm])
+                    key[i - 1] |= 1u << j;
+                perm = levels[i].previous[perm];
+            }
+        }
+        return key;
+    }
+
+    std::cout << "No key with " << (rounds ? std::to_string(rounds) : "<= " + std::to_string(MAX_ROUNDS))
+              << " rounds fits the given blocks" << std::endl;
+    return {};
+}
+
+/**
+ * Main function
+ * Usage: key_recovery <plaintext_file> <ciphertext_file> <block_size_bits> [rounds] [output_key_file]
+ * @return 0 if successful
+ */
+int main(int argc, char **argv) {
+    if (argc < 4) {
+        std::cout << "Usage: " << argv[0]
+                  << " <plaintext_file> <ciphertext_file> <block_size_bits> [rounds] [output_key_file]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::string plaintext_filepath = argv[1];
+    std::string ciphertext_filepath = argv[2];
+    int block_size_bits = std::stoi(argv[3]);
+    int rounds = argc > 4 ? std::stoi(argv[4]) : 0;
+    std::string key_filepath = argc > 5 ? argv[5] : std::string(RECOVERED_KEY_FILE);
+
+    if (block_size_bits <= 0 || block_size_bits % 8 != 0 || block_size_bits > 64 || rounds < 0) {
+        std::cout << "Invalid block size " << block_size_bits << " or number of rounds " << rounds << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto plain_bytes = read_file(plaintext_filepath);
+    auto cipher_bytes = read_file(ciphertext_filepath);
+    if (plain_bytes.empty() || cipher_bytes.empty()) {
+        std::cout << "File " << (plain_bytes.empty() ? plaintext_filepath : ciphertext_filepath) << " is empty"
+                  << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    auto plain_blocks = split_blocks(plain_bytes, block_size_bits);
+    auto cipher_blocks = split_blocks(cipher_bytes, block_size_bits);
+    std::cout << "Recovering key from " << std::min(plain_blocks.size(), cipher_blocks.size()) << " blocks... "
+              << "Block size = " << block_size_bits << " bits" << std::endl;
+
+    int underdetermined = 0;
+    auto key = recover_key(plain_blocks, cipher_blocks, block_size_bits, rounds, &underdetermined);
+    if (key.empty())
+        return EXIT_FAILURE;
+
+    std::cout << "Key has been recovered. Rounds = " << key.size() << std::endl;
+    if (underdetermined)
+        std::cout << underdetermined << " bits of the block were not fully determined by the given blocks, "
+                  << "the key is equivalent only on the seen data" << std::endl;
+
+    // Verify the key with the reference implementation
+    auto encoded_bytes = feistel_transform(plain_bytes, key, block_size_bits, true);
+    auto compared = std::min(encoded_bytes.size(), cipher_bytes.size());
+    if (!std::equal(encoded_bytes.begin(), encoded_bytes.begin() + static_cast<long>(compared), cipher_bytes.begin())) {
+        std::cout << "Recovered key does not reproduce the ciphertext" << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "Recovered key reproduces all " << compared << " ciphertext bytes" << std::endl;
+
+    if (!save_feistel_key(key_filepath, key, block_size_bits))
+        return EXIT_FAILURE;
+    std::cout << "Key has been written to " << key_filepath << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -1,10 +1,36 @@
 import random
+import shutil
+import struct
 import subprocess
+import tempfile
 import unittest
 import os
 
 DATA_SOURCE = "../validation/"
 OUTPUT_DIR = "../out/"
+MAIN = "../main"
+KEY_RECOVERY = "../key_recovery"
+RECOVERED_KEY = "../recovered_keys.txt"
+IN_PLACE_CHUNK_SIZE = 64 * 1024 * 1024  # CHUNK_SIZE in in_place.h
+
+
+def feistel_encode(data, key_lines):
+    """
+    Reference Feistel encoding in python (same round function and bit order as perform_feistel())
+    """
+    half = len(key_lines[0])
+    subkeys = [int(line, 2) for line in key_lines]
+    block_bytes = half * 2 // 8
+    data = data + bytes(-len(data) % block_bytes)
+    out = bytearray()
+    for i in range(0, len(data), block_bytes):
+        block = int.from_bytes(data[i:i + block_bytes], "big")
+        left, right = block >> half, block & ((1 << half) - 1)
+        for subkey in subkeys:
+            left, right = right, left ^ ((right ^ subkey) & subkey)
+        out += ((right << half) | left).to_bytes(block_bytes, "big")
+    return bytes(out)
+
 
 class FeistelTester(unittest.TestCase):
 
@@ -38,4 +64,116 @@ class FeistelTester(unittest.TestCase):
                         with open(os.path.join(OUTPUT_DIR, output_file), "r") as fr:
                             lines = fr.readlines()
                         encoded_hexa_bytes = bytes.fromhex(lines[1].strip())
-                        assert encoded_bytes[:100] == encoded_hexa_bytes
\ No newline at end of file
+                        assert encoded_bytes[:100] == encoded_hexa_bytes
+
+
+    @unittest.skipUnless(os.path.exists(KEY_RECOVERY), "key_recovery binary is not built")
+    def test_recovered_key(self):
+        """
+        This test recovers the key from every plaintext and .bin file pair and checks, that the recovered key
+        encodes the plaintext to the same .bin file
+        """
+        with open("../keys.txt", "r") as fr:
+            block_size = len(fr.readline().strip()) * 2
+
+        for validation_file in sorted(os.listdir(DATA_SOURCE)):
+            encoded_file = os.path.join(OUTPUT_DIR, validation_file[:validation_file.rfind(".")] + ".bin")
+            if not os.path.exists(encoded_file):
+                continue
+            subprocess.run([KEY_RECOVERY, os.path.join(DATA_SOURCE, validation_file), encoded_file,
+                            str(block_size), "0", RECOVERED_KEY], check=True, capture_output=True)
+
+            with open(RECOVERED_KEY, "r") as fr:
+                key_lines = [line.strip() for line in fr.readlines() if line.strip()]
+            with open(os.path.join(DATA_SOURCE, validation_file), "rb") as fr:
+                plain_bytes = fr.read()
+            with open(encoded_file, "rb") as fr:
+                encoded_bytes = fr.read()
+            assert feistel_encode(plain_bytes, key_lines) == encoded_bytes
+
+    @unittest.skipUnless(os.path.exists(MAIN), "main binary is not built")
+    def test_in_place(self):
+        """
+        This test encodes a copy of every validation file in place (main --in-place), checks the result against the
+        .bin file written by the normal mode followed by the FEISTPAD trailer, then decodes it in place and checks
+        that the original bytes (and length) come back
+        """
+        with open("../keys.txt", "r") as fr:
+            block_bytes = len(fr.readline().strip()) * 2 // 8
+
+        padded_tail_tested = False
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            for validation_file in sorted(os.listdir(DATA_SOURCE)):
+                encoded_file = os.path.join(OUTPUT_DIR, validation_file[:validation_file.rfind(".")] + ".bin")
+                if not os.path.exists(encoded_file):
+                    continue
+                with open(os.path.join(DATA_SOURCE, validation_file), "rb") as fr:
+                    plain_bytes = fr.read()
+                with open(encoded_file, "rb") as fr:
+                    encoded_bytes = fr.read()
+
+                in_place_file = os.path.join(tmp_dir, validation_file)
+                shutil.copyfile(os.path.join(DATA_SOURCE, validation_file), in_place_file)
+
+                subprocess.run([MAIN, "--in-place", "encode", in_place_file, "../keys.txt"], check=True,
+                               capture_output=True)
+                with open(in_place_file, "rb") as fr:
+                    in_place_bytes = fr.read()
+                # padded data is identical to the normal mode output, the trailer stores the original size
+                assert in_place_bytes == encoded_bytes + b"FEISTPAD" + struct.pack("=Q", len(plain_bytes))
+                assert not os.path.exists(in_place_file + ".journal")
+
+                subprocess.run([MAIN, "--in-place", "decode", in_place_file, "../keys.txt"], check=True,
+                               capture_output=True)
+                with open(in_place_file, "rb") as fr:
+                    decoded_bytes = fr.read()
+                assert len(decoded_bytes) == len(plain_bytes)
+                assert decoded_bytes == plain_bytes
+                assert not os.path.exists(in_place_file + ".journal")
+
+                if len(plain_bytes) % block_bytes != 0:
+                    padded_tail_tested = True
+
+        # at least one file has to end with a partial block (zero padded tail)
+        assert padded_tail_tested
+
+    @unittest.skipUnless(os.path.exists(MAIN), "main binary is not built")
+    def test_in_place_chunks(self):
+        """
+        This test encodes a file larger than one in place chunk whose size is not a multiple of the block size,
+        checks the chunk boundary and the padded tail against the reference encoding and decodes it back
+        """
+        with open("../keys.txt", "r") as fr:
+            key_lines = [line.strip() for line in fr.readlines() if line.strip()]
+        block_bytes = len(key_lines[0]) * 2 // 8
+
+        random.seed(2023)
+        plain_bytes = random.randbytes(IN_PLACE_CHUNK_SIZE + 3 * block_bytes + 1)
+        boundary = IN_PLACE_CHUNK_SIZE - block_bytes
+        tail = len(plain_bytes) // block_bytes * block_bytes
+
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            in_place_file = os.path.join(tmp_dir, "chunks.bin")
+            with open(in_place_file, "wb") as fw:
+                fw.write(plain_bytes)
+
+            subprocess.run([MAIN, "--in-place", "encode", in_place_file, "../keys.txt"], check=True,
+                           capture_output=True)
+            with open(in_place_file, "rb") as fr:
+                in_place_bytes = fr.read()
+            padded_size = tail + block_bytes
+            assert len(in_place_bytes) == padded_size + 16
+            assert in_place_bytes[:64] == feistel_encode(plain_bytes[:64], key_lines)
+            assert (in_place_bytes[boundary:boundary + 2 * block_bytes] ==
+                    feistel_encode(plain_bytes[boundary:boundary + 2 * block_bytes], key_lines))
+            assert in_place_bytes[tail:padded_size] == feistel_encode(plain_bytes[tail:], key_lines)
+            assert in_place_bytes[padded_size:] == b"FEISTPAD" + struct.pack("=Q", len(plain_bytes))
+            assert not os.path.exists(in_place_file + ".journal")
+
+            subprocess.run([MAIN, "--in-place", "decode", in_place_file, "../keys.txt"], check=True,
+                           capture_output=True)
+            with open(in_place_file, "rb") as fr:
+                decoded_bytes = fr.read()
+            assert len(decoded_bytes) == len(plain_bytes)
+            assert decoded_bytes == plain_bytes
+            assert not os.path.exists(in_place_file + ".journal")
@@ -0,0 +1,239 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <optional>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include "my_big_int.h"
+#include "lattice.h"
+
+/** Big integer used by the attack (the same one as the knapsack uses) */
+using BigInt = MPInt<int32_t, UNLIMITED, BinaryLimbs>;
+/** File where the recovered bytes are stored by default */
+constexpr std::string_view DEFAULT_OUTPUT = "attack_output.bin";
+
+/**
+ * Reads the public key (decimal numbers separated by commas, see main.cpp)
+ * @param filepath Filepath of the public key
+ * @return Public key (empty if the file can't be read)
+ */
+std::vector<BigInt> load_public_key(const std::string &filepath) {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        std::cout << "Unable to open file " << filepath << std::endl;
+        return {};
+    }
+
+    std::vector<BigInt> res;
+    std::string number;
+    while (std::getline(file, number, ',')) {
+        number.erase(number.find_last_not_of(" \r\n") + 1);
+        if (!number.empty())
+            res.emplace_back(number);
+    }
+    return res;
+}
+
+/**
+ * Reads the encoded blocks (one decimal number per line, see main.cpp)
+ * @param filepath Filepath of the ciphertext
+ * @return Encoded blocks (empty if the file can't be read)
+ */
+std::vector<BigInt> load_ciphertext(const std::string &filepath) {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        std::cout << "Unable to open file " << filepath << std::endl;
+        return {};
+    }
+
+    std::vector<BigInt> res;
+    std::string line;
+    while (std::getline(file, line)) {
+        line.erase(line.find_last_not_of(" \r") + 1);
+        if (!line.empty())
+            res.emplace_back(line);
+    }
+    return res;
+}
+
+/**
+ * Builds the lattice of Coster, Joux, LaMacchia, Odlyzko, Schnorr and Stern for a subset sum (scaled by 2, so all
+ * entries are integers)
+ * Rows are (2 e_i, N a_i) for every element of the public key and (1, ..., 1, N s) for the sum, a solution x gives
+ * the vector (2 x_i - 1, 0), which has the norm sqrt(n) and all entries +-1
+ * @param public_key Public key (a_i)
+ * @param sum Encoded block (s)
+ * @return Basis of the lattice
+ */
+std::vector<std::vector<BigInt>> build_cjloss_lattice(const std::vector<BigInt> &public_key, const BigInt &sum) {
+    const size_t n = public_key.size();
+    // Weight N > sqrt(n) makes every vector with a non-zero last entry longer than the solution
+    const BigInt weight(static_cast<int64_t>(std::sqrt(static_cast<double>(n))) + 1);
+
+    std::vector<std::vector<BigInt>> basis(n + 1, std::vector<BigInt>(n + 1, BigInt(0)));
+    for (size_t i = 0; i < n; i++) {
+        basis[i][i] = BigInt(2);
+        basis[i][n] = weight * public_key[i];
+    }
+    for (size_t i = 0; i < n; i++)
+        basis[n][i] = BigInt(1);
+    basis[n][n] = weight * sum;
+    return basis;
+}
+
+/**
+ * Tries to read a solution of the subset sum from a vector of the reduced lattice
+ * @param vector Vector of the lattice
+ * @param public_key Public key
+ * @param sum Encoded block
+ * @return Bits of the block (bit i tells if a_i is in the sum) if the vector is a solution
+ */
+std::optional<std::vector<bool>> solution_from_vector(const std::vector<BigInt> &vector,
+                                                      const std::vector<BigInt> &public_key, const BigInt &sum) {
+    const size_t n = public_key.size();
+    if (!vector[n].isZero())
+        return std::nullopt;
+    for (size_t i = 0; i < n; i++) {
+        if (vector[i].getNumber().size() != 1 || vector[i].getNumber()[0] != 1)
+            return std::nullopt;
+    }
+
+    // Both v and -v are in the lattice, the sum tells which one it is
+    for (int32_t sign : {1, -1}) {
+        std::vector<bool> bits(n);
+        BigInt subset_sum(0);
+        for (size_t i = 0; i < n; i++) {
+            bits[i] = vector[i].getSign() == sign;
+            if (bits[i])
+                subset_sum += public_key[i];
+        }
+        if (subset_sum == sum)
+            return bits;
+    }
+    return std::nullopt;
+}
+
+/**
+ * Recovers the bits of one encoded block by the lattice reduction
+ * @param public_key Public key
+ * @param sum Encoded block
+ * @param block_size Block size of BKZ (BKZ runs only if LLL doesn't find the solution, 0 for LLL only)
+ * @param log Description of the reduction (filled)
+ * @return Bits of the block if a solution was found
+ */
+std::optional<std::vector<bool>> attack_block(const std::vector<BigInt> &public_key, const BigInt &sum,
+                                              size_t block_size, std::string &log) {
+    // Zero block (only padding) has no lattice vector to find
+    if (sum.isZero())
+        return std::vector<bool>(public_key.size(), false);
+
+    auto find_solution = [&](const LatticeReduction<BigInt> &reduction) -> std::optional<std::vector<bool>> {
+        for (auto &vector : reduction.getBasis()) {
+            if (auto bits = solution_from_vector(vector, public_key, sum))
+                return bits;
+        }
+        return std::nullopt;
+    };
+
+    LatticeReduction<BigInt> reduction(build_cjloss_lattice(public_key, sum));
+    reduction.lll();
+    auto bits = find_solution(reduction);
+    if (!bits && block_size >= 2) {
+        reduction.bkz(block_size);
+        bits = find_solution(reduction);
+    }
+
+    std::ostringstream description;
+    description << reduction.getSwaps() << " swaps, " << reduction.getExactProducts() << " exact inner products";
+    log = description.str();
+    return bits;
+}
+
+/**
+ * Main function
+ * Lattice attack on the knapsack - every encoded block is a subset sum of the public key, the lattice of CJLOSS
+ * (Lagarias-Odlyzko improved by Coster et al.) is reduced by LLL (and BKZ if requested) and its short vectors are
+ * checked for a solution
+ * Recovered bits are written as bytes in the same order as the knapsack encodes them (padding bits at the end
+ * are zeros, the text ciphertext doesn't store their number)
+ * Usage: attack <public_key.txt> <ciphertext.txt> [output] [--bkz <block size>]
+ * @param argc Number of arguments
+ * @param argv Arguments
+ * @return 0 if all blocks were recovered
+ */
+int main(int argc, char **argv) {
+    std::vector<std::string> positional;
+    size_t block_size = 0;
+    for (int i = 1; i < argc; i++) {
+        std::string argument = argv[i];
+        if (argument == "--bkz" && i + 1 < argc)
+            block_size = std::stoul(argv[++i]);
+        else
+            positional.push_back(argument);
+    }
+    if (positional.size() < 2 || positional.size() > 3) {
+        std::cout << "Usage: attack <public_key.txt> <ciphertext.txt> [output] [--bkz <block size>]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    const std::string output_filepath = positional.size() == 3 ? positional[2] : std::string(DEFAULT_OUTPUT);
+
+    const auto public_key = load_public_key(positional[0]);
+    const auto blocks = load_ciphertext(positional[1]);
+    if (public_key.empty() || blocks.empty())
+        return EXIT_FAILURE;
+    const size_t n = public_key.size();
+    uint64_t max_bits = 0;
+    for (auto &element : public_key)
+        max_bits = std::max(max_bits, element.bitLength());
+    std::cout << "Public key: " << n << " elements, density " << static_cast<double>(n) / static_cast<double>(max_bits)
+              << ", " << blocks.size() << " blocks" << std::endl;
+
+    // Blocks are independent, every thread takes the next unsolved one
+    std::vector<std::optional<std::vector<bool>>> results(blocks.size());
+    std::atomic<size_t> next_block = 0;
+    std::mutex output_mutex;
+    auto worker = [&]() {
+        for (size_t block = next_block++; block < blocks.size(); block = next_block++) {
+            auto start = std::chrono::steady_clock::now();
+            std::string log;
+            results[block] = attack_block(public_key, blocks[block], block_size, log);
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            std::lock_guard<std::mutex> lock(output_mutex);
+            std::cout << "Block " << block << ": " << (results[block] ? "recovered" : "not recovered") << " in "
+                      << elapsed.count() << " s (" << log << ")" << std::endl;
+        }
+    };
+    const size_t thread_count = std::max(1u, std::min<unsigned>(std::thread::hardware_concurrency(), blocks.size()));
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < thread_count; i++)
+        threads.emplace_back(worker);
+    worker();
+    for (auto &thread : threads)
+        thread.join();
+
+    // Bit i of the block is the bit (7 - p % 8) of the byte p / 8, where p = block * n + i
+    std::vector<unsigned char> bytes(blocks.size() * n / 8, 0);
+    size_t recovered = 0;
+    for (size_t block = 0; block < blocks.size(); block++) {
+        if (!results[block])
+            continue;
+        recovered++;
+        for (size_t i = 0; i < n; i++) {
+            auto position = block * n + i;
+            if ((*results[block])[i] && position / 8 < bytes.size())
+                bytes[position / 8] |= 1 << (7 - position % 8);
+        }
+    }
+
+    std::ofstream output(output_filepath, std::ios::binary);
+    output.write(reinterpret_cast<const char *>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+    std::cout << "Recovered " << recovered << " of " << blocks.size() << " blocks, bytes written to "
+              << output_filepath << std::endl;
+    return recovered == blocks.size() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,534 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <limits>
+#include <map>
+#include <tuple>
+#include <cstdlib>
+#include "allocation_counter.h"
+#include "bignum_mpint.h"
+#include "bignum_biginteger.h"
+
+/** MPInt used by the benchmark (the same one as the knapsack uses) */
+using BigInt = MPInt<int32_t, UNLIMITED, BinaryLimbs>;
+/** Operand sizes (in bits) */
+constexpr uint64_t OPERAND_BITS[] = {64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384};
+/** Maximum size of the exponent of the modular exponentiation (in bits, below it has the size of the modulus) */
+constexpr uint64_t MAX_EXPONENT_BITS = 1024;
+/** Minimal measured time of one trial (in seconds) */
+constexpr double MIN_TIME = 0.02;
+/** Number of trials of one configuration, the fastest one is taken (the others are disturbed by the system) */
+constexpr int TRIALS = 3;
+/** Default allowed slowdown against the baseline (fraction of the baseline time) */
+constexpr double DEFAULT_TOLERANCE = 0.5;
+/** Number of repeated measurements of a configuration slower than the baseline (the slowdown has to be reproducible) */
+constexpr int RETRIES = 3;
+
+/** Results of the measured operations are stored here, so the compiler can't remove them */
+static volatile uint64_t sink = 0;
+
+/**
+ * Benchmarked operation
+ */
+enum class Operation {
+    ADD, SUB, MUL, DIV, MOD, MOD_POW, TO_STRING, FROM_STRING
+};
+
+/** All benchmarked operations */
+constexpr Operation OPERATIONS[] = {Operation::ADD, Operation::SUB, Operation::MUL, Operation::DIV, Operation::MOD,
+                                    Operation::MOD_POW, Operation::TO_STRING, Operation::FROM_STRING};
+
+/**
+ * Returns the name of the operation (used in the output and in the baseline)
+ * @param operation Operation
+ * @return Name of the operation
+ */
+std::string operation_name(Operation operation) {
+    switch (operation) {
+        case Operation::ADD:
+            return "add";
+        case Operation::SUB:
+            return "sub";
+        case Operation::MUL:
+            return "mul";
+        case Operation::DIV:
+            return "div";
+        case Operation::MOD:
+            return "mod";
+        case Operation::MOD_POW:
+            return "modpow";
+        case Operation::TO_STRING:
+            return "to_string";
+        case Operation::FROM_STRING:
+            return "from_string";
+    }
+    return "unknown";
+}
+
+/**
+ * Random operands of one size as bits (32-bit words, the least significant first)
+ * Both libraries get the same numbers, every number has exactly the given number of bits
+ */
+struct OperandBits {
+    /** First operand (bits bits) */
+    std::vector<uint32_t> x;
+    /** Second operand (bits bits) */
+    std::vector<uint32_t> y;
+    /** Dividend (2 * bits bits) */
+    std::vector<uint32_t> wide;
+    /** Odd modulus (bits bits) */
+    std::vector<uint32_t> modulus;
+    /** Exponent (at most MAX_EXPONENT_BITS bits) */
+    std::vector<uint32_t> exponent;
+};
+
+/**
+ * Generates random bits of a number with exactly the given number of bits
+ * @param bits Number of bits
+ * @param gen Random generator
+ * @return Bits in 32-bit words (the least significant first)
+ */
+std::vector<uint32_t> random_words(uint64_t bits, std::mt19937_64 &gen) {
+    std::vector<uint32_t> words((bits + 31) / 32);
+    for (auto &word : words)
+        word = static_cast<uint32_t>(gen());
+    if (bits % 32)
+        words.back() &= (uint32_t{1} << (bits % 32)) - 1;
+    words[(bits - 1) / 32] |= uint32_t{1} << ((bits - 1) % 32);
+    return words;
+}
+
+/**
+ * Generates random operands of one size
+ * @param bits Size of the operands (in bits)
+ * @param gen Random generator
+ * @return Operands
+ */
+OperandBits random_operands(uint64_t bits, std::mt19937_64 &gen) {
+    OperandBits res{random_words(bits, gen), random_words(bits, gen), random_words(2 * bits, gen),
+                    random_words(bits, gen), random_words(std::min(bits, MAX_EXPONENT_BITS), gen)};
+    res.modulus[0] |= 1;
+    return res;
+}
+
+/**
+ * Benchmarked library MPInt (my_big_int.h)
+ */
+struct MPIntBackend {
+    /** Number type */
+    using Num = BigInt;
+    /** Name of the library (used in the output and in the baseline) */
+    static constexpr std::string_view NAME = "MPInt";
+
+    /**
+     * Builds the number from bits
+     * @param words Bits in 32-bit words
+     * @return Number
+     */
+    static Num fromWords(const std::vector<uint32_t> &words) {
+        return {Num::Storage(words.begin(), words.end()), 1};
+    }
+
+    /**
+     * Converts the number to a decimal string
+     * @param num Number
+     * @return Decimal string
+     */
+    static std::string toString(const Num &num) {
+        return num.toString();
+    }
+
+    /**
+     * Parses the number from a decimal string
+     * @param str Decimal string
+     * @return Number
+     */
+    static Num fromString(const std::string &str) {
+        return Num(str);
+    }
+
+    /**
+     * Computes base^exponent mod modulus (mod_pow() of the shared library, window and Barrett reduction)
+     * @param base Base
+     * @param exponent Exponent
+     * @param modulus Modulus
+     * @return Power
+     */
+    static Num modPow(const Num &base, const Num &exponent, const Num &modulus) {
+        return mod_pow(base, exponent, modulus);
+    }
+};
+
+/**
+ * Benchmarked library BigInteger (bignum/biginteger.cpp, 31-bit limbs)
+ */
+struct BigIntegerBackend {
+    /** Number type */
+    using Num = BigInteger;
+    /** Name of the library (used in the output and in the baseline) */
+    static constexpr std::string_view NAME = "BigInteger";
+
+    /**
+     * Builds the number from bits (the bits are regrouped to limbs of BigInteger::limbBits() bits)
+     * @param words Bits in 32-bit words
+     * @return Number
+     */
+    static Num fromWords(const std::vector<uint32_t> &words) {
+        const auto limb_bits = static_cast<uint64_t>(BigInteger::limbBits());
+        std::vector<digit> limbs((words.size() * 32 + limb_bits - 1) / limb_bits, 0);
+        for (uint64_t bit = 0; bit < words.size() * 32; bit++) {
+            if (words[bit / 32] >> (bit % 32) & 1)
+                limbs[bit / limb_bits] |= digit{1} << (bit % limb_bits);
+        }
+        return BigInteger::fromLimbs(limbs);
+    }
+
+    /**
+     * Converts the number to a decimal string
+     * @param num Number
+     * @return Decimal string
+     */
+    static std::string toString(const Num &num) {
+        std::ostringstream stream;
+        stream << num;
+        return stream.str();
+    }
+
+    /**
+     * Parses the number from a decimal string
+     * @param str Decimal string
+     * @return Number
+     */
+    static Num fromString(const std::string &str) {
+        return Num(str);
+    }
+
+    /**
+     * Computes base^exponent mod modulus (mod_pow() of the shared library, window and long division)
+     * @param base Base
+     * @param exponent Exponent
+     * @param modulus Modulus
+     * @return Power
+     */
+    static Num modPow(const Num &base, const Num &exponent, const Num &modulus) {
+        return mod_pow(base, exponent, modulus);
+    }
+};
+
+/**
+ * Result of one benchmarked configuration
+ */
+struct Measurement {
+    /** Name of the library */
+    std::string library;
+    /** Name of the operation */
+    std::string operation;
+    /** Size of the operands (in bits) */
+    uint64_t bits;
+    /** Time of one operation (in nanoseconds, the fastest of all trials) */
+    double nanoseconds;
+    /** Number of heap allocations of one operation */
+    uint64_t allocations;
+    /** Result in decimal (both libraries have to agree) */
+    std::string result;
+};
+
+/**
+ * Measures one operation of one library
+ * @param operation Operation
+ * @param bits Size of the operands (in bits)
+ * @param operands Operands
+ * @tparam Backend Library
+ * @return Measurement
+ */
+template<typename Backend>
+Measurement measure(Operation operation, uint64_t bits, const OperandBits &operands) {
+    using Num = typename Backend::Num;
+    const Num x = Backend::fromWords(operands.x), y = Backend::fromWords(operands.y);
+    const Num wide = Backend::fromWords(operands.wide), modulus = Backend::fromWords(operands.modulus);
+    const Num exponent = Backend::fromWords(operands.exponent);
+    const std::string decimal = Backend::toString(x);
+
+    // Every operation returns its result as a decimal string only after the measurement
+    std::string result;
+    auto run = [&]() -> std::string {
+        switch (operation) {
+            case Operation::ADD:
+                return Backend::toString(x + y);
+            case Operation::SUB:
+                return Backend::toString(x - y);
+            case Operation::MUL:
+                return Backend::toString(x * y);
+            case Operation::DIV:
+                return Backend::toString(wide / y);
+            case Operation::MOD:
+                return Backend::toString(wide % y);
+            case Operation::MOD_POW:
+                return Backend::toString(Backend::modPow(x, exponent, modulus));
+            case Operation::TO_STRING:
+                return Backend::toString(x);
+            case Operation::FROM_STRING:
+                return Backend::toString(Backend::fromString(decimal));
+        }
+        return {};
+    };
+    // Measured operation without the conversion of the result
+    auto operation_only = [&]() {
+        switch (operation) {
+            case Operation::ADD:
+                sink = (x + y).bitLength();
+                break;
+            case Operation::SUB:
+                sink = (x - y).bitLength();
+                break;
+            case Operation::MUL:
+                sink = (x * y).bitLength();
+                break;
+            case Operation::DIV:
+                sink = (wide / y).bitLength();
+                break;
+            case Operation::MOD:
+                sink = (wide % y).bitLength();
+                break;
+            case Operation::MOD_POW:
+                sink = Backend::modPow(x, exponent, modulus).bitLength();
+                break;
+            case Operation::TO_STRING:
+                sink = Backend::toString(x).size();
+                break;
+            case Operation::FROM_STRING:
+                sink = Backend::fromString(decimal).bitLength();
+                break;
+        }
+    };
+
+    result = run();
+    const auto allocations_before = allocation_count();
+    operation_only();
+    const auto allocations = allocation_count() - allocations_before;
+
+    double best = std::numeric_limits<double>::max();
+    for (int trial = 0; trial < TRIALS; trial++) {
+        int repetitions = 0;
+        std::chrono::duration<double> elapsed{0};
+        do {
+            auto start = std::chrono::steady_clock::now();
+            operation_only();
+            elapsed += std::chrono::steady_clock::now() - start;
+            repetitions++;
+        } while (elapsed.count() < MIN_TIME);
+        best = std::min(best, elapsed.count() / repetitions);
+    }
+
+    return {std::string(Backend::NAME), operation_name(operation), bits, best * 1e9, allocations, result};
+}
+
+/** Key of a measurement in the baseline (library, operation, bits) */
+using BaselineKey = std::tuple<std::string, std::string, uint64_t>;
+
+/**
+ * Writes the measurements as CSV (library,operation,bits,ns_per_op,allocations_per_op)
+ * @param filepath Filepath of the output
+ * @param measurements Measurements
+ * @return True if the file was written
+ */
+bool write_csv(const std::string &filepath, const std::vector<Measurement> &measurements) {
+    std::ofstream file(filepath);
+    if (!file.is_open()) {
+        std::cout << "Unable to open file " << filepath << std::endl;
+        return false;
+    }
+    file << "library,operation,bits,ns_per_op,allocations_per_op" << std::endl;
+    for (auto &m : measurements)
+        file << m.library << "," << m.operation << "," << m.bits << "," << m.nanoseconds << "," << m.allocations
+             << std::endl;
+    return file.good();
+}
+
+/**
+ * Writes the measurements as JSON (array of objects with the same fields as the CSV)
+ * @param filepath Filepath of the output
+ * @param measurements Measurements
+ * @return True if the file was written
+ */
+bool write_json(const std::string &filepath, const std::vector<Measurement> &measurements) {
+    std::ofstream file(filepath);
+    if (!file.is_open()) {
+        std::cout << "Unable to open file " << filepath << std::endl;
+        return false;
+    }
+    file << "[" << std::endl;
+    for (size_t i = 0; i < measurements.size(); i++) {
+        auto &m = measurements[i];
+        file << "  {\"library\": \"" << m.library << "\", \"operation\": \"" << m.operation << "\", \"bits\": "
+             << m.bits << ", \"ns_per_op\": " << m.nanoseconds << ", \"allocations_per_op\": " << m.allocations
+             << "}" << (i + 1 < measurements.size() ? "," : "") << std::endl;
+    }
+    file << "]" << std::endl;
+    return file.good();
+}
+
+/**
+ * Reads the baseline (CSV written by write_csv())
+ * @param filepath Filepath of the baseline
+ * @param baseline Measurements of the baseline (filled)
+ * @return True if the baseline was read
+ */
+bool read_baseline(const std::string &filepath, std::map<BaselineKey, std::pair<double, uint64_t>> &baseline) {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        std::cout << "Unable to open file " << filepath << std::endl;
+        return false;
+    }
+    std::string line;
+    std::getline(file, line); // Header
+    while (std::getline(file, line)) {
+        std::stringstream stream(line);
+        std::string library, operation, bits, nanoseconds, allocations;
+        if (!std::getline(stream, library, ',') || !std::getline(stream, operation, ',') ||
+            !std::getline(stream, bits, ',') || !std::getline(stream, nanoseconds, ',') ||
+            !std::getline(stream, allocations, ','))
+            continue;
+        baseline[{library, operation, std::stoull(bits)}] = {std::stod(nanoseconds), std::stoull(allocations)};
+    }
+    return true;
+}
+
+/**
+ * Tells if a measurement regressed against the baseline - it's slower by more than the tolerance or allocates more
+ * @param m Measurement
+ * @param baseline Measurements of the baseline
+ * @param tolerance Allowed slowdown (fraction of the baseline time)
+ * @return True if the configuration is in the baseline and regressed
+ */
+bool is_regression(const Measurement &m, const std::map<BaselineKey, std::pair<double, uint64_t>> &baseline,
+                   double tolerance) {
+    auto it = baseline.find({m.library, m.operation, m.bits});
+    if (it == baseline.end())
+        return false;
+    const auto [nanoseconds, allocations] = it->second;
+    return m.nanoseconds > nanoseconds * (1 + tolerance) || m.allocations > allocations;
+}
+
+/**
+ * Compares the measurements with the baseline and prints the regressed configurations
+ * @param measurements Measurements
+ * @param baseline Measurements of the baseline
+ * @param tolerance Allowed slowdown (fraction of the baseline time)
+ * @return Number of regressed configurations
+ */
+int check_regressions(const std::vector<Measurement> &measurements,
+                      const std::map<BaselineKey, std::pair<double, uint64_t>> &baseline, double tolerance) {
+    int regressions = 0;
+    for (auto &m : measurements) {
+        if (!is_regression(m, baseline, tolerance))
+            continue;
+        const auto [nanoseconds, allocations] = baseline.at({m.library, m.operation, m.bits});
+        std::cout << "Regression: " << m.library << " " << m.operation << " " << m.bits << " bits: " << m.nanoseconds
+                  << " ns (baseline " << nanoseconds << " ns), " << m.allocations << " allocations (baseline "
+                  << allocations << ")" << std::endl;
+        regressions++;
+    }
+    return regressions;
+}
+
+/**
+ * Main function
+ * Compares MPInt (my_big_int.h) and BigInteger (bignum/biginteger.h) on random operands of 64 - 16384 bits - time
+ * and heap allocations of addition, subtraction, multiplication, division, remainder, modular exponentiation and
+ * decimal string conversions, both libraries have to return the same results
+ * Usage: bignum_bench [--csv <file>] [--json <file>] [--baseline <csv>] [--tolerance <fraction>] [--max-bits <bits>]
+ * @param argc Number of arguments
+ * @param argv Arguments
+ * @return 0 if the libraries agree and nothing regressed against the baseline
+ */
+int main(int argc, char **argv) {
+    std::string csv_filepath, json_filepath, baseline_filepath;
+    double tolerance = DEFAULT_TOLERANCE;
+    uint64_t max_bits = OPERAND_BITS[std::size(OPERAND_BITS) - 1];
+    for (int i = 1; i < argc; i++) {
+        std::string argument = argv[i];
+        if (i + 1 >= argc) {
+            std::cout << "Missing value of " << argument << std::endl;
+            return EXIT_FAILURE;
+        }
+        if (argument == "--csv")
+            csv_filepath = argv[++i];
+        else if (argument == "--json")
+            json_filepath = argv[++i];
+        else if (argument == "--baseline")
+            baseline_filepath = argv[++i];
+        else if (argument == "--tolerance")
+            tolerance = std::stod(argv[++i]);
+        else if (argument == "--max-bits")
+            max_bits = std::stoull(argv[++i]);
+        else {
+            std::cout << "Usage: bignum_bench [--csv <file>] [--json <file>] [--baseline <csv>] "
+                         "[--tolerance <fraction>] [--max-bits <bits>]" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::map<BaselineKey, std::pair<double, uint64_t>> baseline;
+    if (!baseline_filepath.empty() && !read_baseline(baseline_filepath, baseline))
+        return EXIT_FAILURE;
+
+    // Fixed seed, so all runs measure the same numbers
+    std::mt19937_64 gen(42);
+    std::vector<std::pair<uint64_t, OperandBits>> operands_of_size;
+    std::vector<Measurement> measurements;
+    bool agree = true;
+    for (auto bits : OPERAND_BITS) {
+        if (bits > max_bits)
+            break;
+        auto &operands = operands_of_size.emplace_back(bits, random_operands(bits, gen)).second;
+        for (auto operation : OPERATIONS) {
+            auto mpint = measure<MPIntBackend>(operation, bits, operands);
+            auto biginteger = measure<BigIntegerBackend>(operation, bits, operands);
+
+            std::cout << mpint.operation << " " << bits << " bits: MPInt " << mpint.nanoseconds << " ns ("
+                      << mpint.allocations << " allocations), BigInteger " << biginteger.nanoseconds << " ns ("
+                      << biginteger.allocations << " allocations), speedup of MPInt "
+                      << biginteger.nanoseconds / mpint.nanoseconds;
+            if (mpint.result != biginteger.result) {
+                std::cout << " - results differ";
+                agree = false;
+            }
+            std::cout << std::endl;
+            measurements.push_back(std::move(mpint));
+            measurements.push_back(std::move(biginteger));
+        }
+    }
+
+    // Configurations slower than the baseline are measured again after all the others (a disturbance by the system
+    // rarely lasts so long), the fastest time is kept
+    for (int retry = 0; retry < RETRIES && !baseline.empty(); retry++) {
+        size_t index = 0;
+        for (auto &[bits, operands] : operands_of_size) {
+            for (auto operation : OPERATIONS) {
+                auto &mpint = measurements[index++];
+                if (is_regression(mpint, baseline, tolerance))
+                    mpint.nanoseconds = std::min(mpint.nanoseconds,
+                                                 measure<MPIntBackend>(operation, bits, operands).nanoseconds);
+                auto &biginteger = measurements[index++];
+                if (is_regression(biginteger, baseline, tolerance))
+                    biginteger.nanoseconds = std::min(
+                            biginteger.nanoseconds, measure<BigIntegerBackend>(operation, bits, operands).nanoseconds);
+            }
+        }
+    }
+
+    if (!csv_filepath.empty() && !write_csv(csv_filepath, measurements))
+        return EXIT_FAILURE;
+    if (!json_filepath.empty() && !write_json(json_filepath, measurements))
+        return EXIT_FAILURE;
+
+    int regressions = baseline.empty() ? 0 : check_regressions(measurements, baseline, tolerance);
+    if (!baseline.empty())
+        std::cout << regressions << " regressions against " << baseline_filepath << std::endl;
+    return agree && !regressions ? EXIT_SUCCESS : EXIT_FAILURE;
+}
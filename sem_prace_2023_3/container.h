@@ -0,0 +1,317 @@
+#pragma once
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <cstdint>
+#include "my_big_int.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/** Magic bytes of the container */
+constexpr char CONTAINER_MAGIC[8] = {'K', 'N', 'A', 'P', 'S', 'A', 'C', 'K'};
+/** Version of the container format */
+constexpr uint32_t CONTAINER_VERSION = 1;
+/** Size of one limb in the container (in bytes) */
+constexpr uint32_t CONTAINER_LIMB_BYTES = sizeof(uint32_t);
+
+/**
+ * Kind of the numbers stored in the container
+ */
+enum class ContainerKind : uint32_t {
+    /** Encoded blocks */
+    CIPHERTEXT = 1,
+    /** Keys (see save_keys() in main.cpp for the order of the numbers) */
+    KEYS = 2
+};
+
+/**
+ * Header of the container, all fields are little endian
+ * Numbers follow right after the header, every number has the same number of limbs (the least significant limb
+ * first, little endian, zero extended), so the number i is at sizeof(ContainerHeader) + i * limbs * limb_bytes
+ */
+struct ContainerHeader {
+    /** CONTAINER_MAGIC */
+    char magic[8];
+    /** CONTAINER_VERSION */
+    uint32_t version;
+    /** ContainerKind */
+    uint32_t kind;
+    /** Size of the key in bits */
+    uint32_t key_size;
+    /** Padding of the input bits (ciphertext only) */
+    uint32_t padding;
+    /** Size of one limb in bytes (CONTAINER_LIMB_BYTES) */
+    uint32_t limb_bytes;
+    /** Number of limbs of every number */
+    uint32_t limbs;
+    /** Number of numbers */
+    uint64_t count;
+};
+static_assert(sizeof(ContainerHeader) == 40, "Container header must not be padded");
+
+/**
+ * Converts a value between the native and the little endian byte order (the conversion is the same in both ways)
+ * @param value Value
+ * @tparam U Unsigned integer type
+ * @return Converted value
+ */
+template<std::unsigned_integral U>
+constexpr U little_endian(U value) {
+    if constexpr (std::endian::native == std::endian::big)
+        return std::byteswap(value);
+    return value;
+}
+
+/**
+ * Converts all fields of the header between the native and the little endian byte order
+ * @param header Header
+ * @return Converted header
+ */
+constexpr ContainerHeader little_endian(ContainerHeader header) {
+    header.version = little_endian(header.version);
+    header.kind = little_endian(header.kind);
+    header.key_size = little_endian(header.key_size);
+    header.padding = little_endian(header.padding);
+    header.limb_bytes = little_endian(header.limb_bytes);
+    header.limbs = little_endian(header.limbs);
+    header.count = little_endian(header.count);
+    return header;
+}
+
+/**
+ * Saves non-negative numbers to the container
+ * @param filepath Filepath of the container
+ * @param kind Kind of the numbers
+ * @param key_size Size of the key in bits
+ * @param padding Padding of the input bits (ciphertext only)
+ * @param numbers Numbers (non-negative, with binary limbs)
+ * @tparam max_digits Maximum number of digits of the numbers
+ * @return True if the container was written, false otherwise
+ */
+template<ValidDigit T, T max_digits>
+bool save_container(const std::string &filepath, ContainerKind kind, uint32_t key_size, uint32_t padding,
+                    const std::vector<MPInt<T, max_digits, BinaryLimbs>> &numbers) {
+    std::ofstream file(filepath, std::ios::binary);
+    if (!file.is_open()) {
+        std::cout << "Unable to open file " << filepath << std::endl;
+        return false;
+    }
+
+    // All numbers have the width of the biggest one
+    uint32_t limbs = 1;
+    for (auto &num : numbers)
+        limbs = std::max(limbs, static_cast<uint32_t>(num.getNumber().size()));
+
+    ContainerHeader header{};
+    std::memcpy(header.magic, CONTAINER_MAGIC, sizeof(CONTAINER_MAGIC));
+    header.version = CONTAINER_VERSION;
+    header.kind = static_cast<uint32_t>(kind);
+    header.key_size = key_size;
+    header.padding = padding;
+    header.limb_bytes = CONTAINER_LIMB_BYTES;
+    header.limbs = limbs;
+    header.count = numbers.size();
+    header = little_endian(header);
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    std::vector<uint32_t> buffer(limbs);
+    for (auto &num : numbers) {
+        std::fill(buffer.begin(), buffer.end(), 0);
+        const auto &digits = num.getNumber();
+        for (size_t i = 0; i < digits.size(); i++)
+            buffer[i] = little_endian(digits[i]);
+        file.write(reinterpret_cast<const char *>(buffer.data()),
+                   static_cast<std::streamsize>(buffer.size() * CONTAINER_LIMB_BYTES));
+    }
+
+    return file.good();
+}
+
+/**
+ * Container opened for reading, the file is memory mapped (or read to the memory where mapping is not available),
+ * numbers are read straight from the mapped limbs without any parsing
+ * @tparam max_digits Maximum number of digits of the numbers
+ */
+template<ValidDigit T, T max_digits>
+class MappedContainer {
+private:
+    /** Bytes of the whole container */
+    const unsigned char *mData;
+    /** Size of the container in bytes */
+    size_t mSize;
+    /** Header (in the native byte order) */
+    ContainerHeader mHeader;
+    /** Bytes of the container read to the memory (only where mapping is not available) */
+    std::vector<unsigned char> mBuffer;
+
+    /**
+     * Checks the header and the size of the container
+     * @param filepath Filepath of the container (printed)
+     * @param kind Expected kind of the numbers
+     * @return True if the container is valid, false otherwise
+     */
+    bool validate(const std::string &filepath, ContainerKind kind) {
+        if (mSize < sizeof(ContainerHeader)) {
+            std::cout << "File " << filepath << " is not a container" << std::endl;
+            return false;
+        }
+        std::memcpy(&mHeader, mData, sizeof(mHeader));
+        mHeader = little_endian(mHeader);
+
+        if (std::memcmp(mHeader.magic, CONTAINER_MAGIC, sizeof(CONTAINER_MAGIC)) != 0 ||
+            mHeader.version != CONTAINER_VERSION || mHeader.limb_bytes != CONTAINER_LIMB_BYTES || !mHeader.limbs) {
+            std::cout << "File " << filepath << " is not a container of version " << CONTAINER_VERSION << std::endl;
+            return false;
+        }
+        if (mHeader.kind != static_cast<uint32_t>(kind)) {
+            std::cout << "Container " << filepath << " holds a different kind of numbers" << std::endl;
+            return false;
+        }
+        const uint64_t number_bytes = static_cast<uint64_t>(mHeader.limbs) * mHeader.limb_bytes;
+        if (mHeader.count > (mSize - sizeof(ContainerHeader)) / number_bytes ||
+            mSize != sizeof(ContainerHeader) + mHeader.count * number_bytes) {
+            std::cout << "Container " << filepath << " is truncated or corrupted" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Reads one limb of a number (limbs don't have to be aligned)
+     * @param limbs Limbs of the number in the container
+     * @param index Index of the limb
+     * @return Limb in the native byte order
+     */
+    static uint32_t readLimb(const unsigned char *limbs, size_t index) {
+        uint32_t limb = 0;
+        std::memcpy(&limb, limbs + index * CONTAINER_LIMB_BYTES, sizeof(limb));
+        return little_endian(limb);
+    }
+
+    /**
+     * Closes the container (unmaps the file)
+     */
+    void close() {
+#if defined(__unix__) || defined(__APPLE__)
+        if (mData && mBuffer.empty())
+            munmap(const_cast<unsigned char *>(mData), mSize);
+#endif
+        mData = nullptr;
+        mSize = 0;
+        mBuffer.clear();
+    }
+
+public:
+    /**
+     * Constructor for the MappedContainer class, opens and validates the container
+     * If the container can't be opened or is invalid, the message is printed and the container is empty (isOpen())
+     * @param filepath Filepath of the container
+     * @param kind Expected kind of the numbers
+     */
+    MappedContainer(const std::string &filepath, ContainerKind kind) : mData(nullptr), mSize(0), mHeader(),
+                                                                        mBuffer() {
+#if defined(__unix__) || defined(__APPLE__)
+        int fd = open(filepath.c_str(), O_RDONLY);
+        if (fd < 0) {
+            std::cout << "Unable to open file " << filepath << std::endl;
+            return;
+        }
+        struct stat file_stat{};
+        fstat(fd, &file_stat);
+        mSize = file_stat.st_size;
+        void *mapping = mSize ? mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+        ::close(fd);
+        if (mapping == MAP_FAILED) {
+            std::cout << "Unable to map file " << filepath << std::endl;
+            mSize = 0;
+            return;
+        }
+        mData = static_cast<const unsigned char *>(mapping);
+#else
+        std::ifstream file(filepath, std::ios::binary);
+        if (!file.is_open()) {
+            std::cout << "Unable to open file " << filepath << std::endl;
+            return;
+        }
+        mBuffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        mData = mBuffer.data();
+        mSize = mBuffer.size();
+#endif
+        if (!validate(filepath, kind))
+            close();
+    }
+
+    MappedContainer(const MappedContainer &) = delete;
+
+    MappedContainer &operator=(const MappedContainer &) = delete;
+
+    /**
+     * Destructor for the MappedContainer class, unmaps the file
+     */
+    ~MappedContainer() {
+        close();
+    }
+
+    /**
+     * Checks if the container was opened and is valid
+     * @return True if the container can be read, false otherwise
+     */
+    [[nodiscard]] bool isOpen() const {
+        return mData != nullptr;
+    }
+
+    /**
+     * Getter for the number of numbers
+     * @return Number of numbers
+     */
+    [[nodiscard]] size_t size() const {
+        return isOpen() ? mHeader.count : 0;
+    }
+
+    /**
+     * Getter for the size of the key
+     * @return Size of the key in bits
+     */
+    [[nodiscard]] uint32_t getKeySize() const {
+        return mHeader.key_size;
+    }
+
+    /**
+     * Getter for the padding
+     * @return Padding of the input bits
+     */
+    [[nodiscard]] uint32_t getPadding() const {
+        return mHeader.padding;
+    }
+
+    /**
+     * Reads the number straight from the limbs of the container
+     * If the index is not smaller than size(), an out of range exception is thrown
+     * @param index Index of the number
+     * @return Number
+     */
+    [[nodiscard]] MPInt<T, max_digits, BinaryLimbs> number(size_t index) const {
+        if (index >= size())
+            throw std::out_of_range("Container has no number with index " + std::to_string(index));
+        const unsigned char *limbs = mData + sizeof(ContainerHeader) + index * mHeader.limbs * CONTAINER_LIMB_BYTES;
+        // Zero extension is not a part of the number
+        size_t size = mHeader.limbs;
+        while (size > 1 && !readLimb(limbs, size - 1))
+            size--;
+
+        typename MPInt<T, max_digits, BinaryLimbs>::Storage digits(size, 0);
+        for (size_t i = 0; i < size; i++)
+            digits[i] = readLimb(limbs, i);
+        return {std::move(digits), 1};
+    }
+};
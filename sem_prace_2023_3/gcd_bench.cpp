@@ -0,0 +1,135 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <limits>
+#include <string>
+#include "my_big_int.h"
+
+/** Big integer used by the benchmark (the same one as the knapsack uses) */
+using BigInt = MPInt<int32_t, UNLIMITED, BinaryLimbs>;
+/** Sizes of the modulus (in bits) */
+constexpr uint64_t MODULUS_BITS[] = {128, 256, 512, 1024, 2048, 4096};
+/** Size of the inverted number in the knapsack (p is a 31 bit prime) */
+constexpr uint64_t SMALL_NUMBER_BITS = 31;
+/** Minimal measured time of one trial (in seconds) */
+constexpr double MIN_TIME = 0.05;
+/** Number of trials of one configuration, the fastest one is taken (the others are disturbed by the system) */
+constexpr int TRIALS = 3;
+
+/**
+ * Modular inverse routine that is benchmarked
+ */
+struct InverseRoutine {
+    /** Name of the routine (printed) */
+    const char *name;
+    /** Routine (number, modulus) */
+    BigInt (*inverse)(const BigInt &, const BigInt &);
+};
+
+/** All benchmarked routines, the first one is the reference */
+const InverseRoutine ROUTINES[] = {
+        {"euclid", mod_inverse_euclid<int32_t, UNLIMITED, BinaryLimbs>},
+        {"lehmer", mod_inverse<int32_t, UNLIMITED, BinaryLimbs>},
+        {"binary", mod_inverse_binary<int32_t, UNLIMITED, BinaryLimbs>},
+};
+
+/**
+ * Generates a random number with exactly the given number of bits
+ * @param bits Number of bits
+ * @param gen Random generator
+ * @return Random number
+ */
+BigInt random_number(uint64_t bits, std::mt19937_64 &gen) {
+    BigInt::Storage digits((bits + 31) / 32, 0);
+    for (auto &digit : digits)
+        digit = static_cast<uint32_t>(gen());
+    if (bits % 32)
+        digits[digits.size() - 1] &= (uint32_t{1} << (bits % 32)) - 1;
+    digits[(bits - 1) / 32] |= uint32_t{1} << ((bits - 1) % 32);
+    return {std::move(digits), 1};
+}
+
+/**
+ * Generates a random pair of a number and a modulus that are coprime
+ * @param number_bits Number of bits of the number
+ * @param modulus_bits Number of bits of the modulus
+ * @param gen Random generator
+ * @return Number and modulus
+ */
+std::pair<BigInt, BigInt> random_pair(uint64_t number_bits, uint64_t modulus_bits, std::mt19937_64 &gen) {
+    while (true) {
+        auto number = random_number(number_bits, gen), modulus = random_number(modulus_bits, gen);
+        if (ext_gcd(number, modulus).first == BigInt(1))
+            return {number, modulus};
+    }
+}
+
+/**
+ * Measures the time of one modular inverse
+ * @param routine Routine
+ * @param number Number
+ * @param modulus Modulus
+ * @return Time of one inverse in seconds (the fastest of all trials)
+ */
+double time_inverse(const InverseRoutine &routine, const BigInt &number, const BigInt &modulus) {
+    double best = std::numeric_limits<double>::max();
+    for (int trial = 0; trial < TRIALS; trial++) {
+        int repetitions = 0;
+        std::chrono::duration<double> elapsed{0};
+        do {
+            auto start = std::chrono::steady_clock::now();
+            auto inverse = routine.inverse(number, modulus);
+            elapsed += std::chrono::steady_clock::now() - start;
+            repetitions++;
+        } while (elapsed.count() < MIN_TIME);
+        best = std::min(best, elapsed.count() / repetitions);
+    }
+    return best;
+}
+
+/**
+ * Benchmarks all routines on one configuration and checks that they agree
+ * @param number_bits Number of bits of the number
+ * @param modulus_bits Number of bits of the modulus
+ * @param gen Random generator
+ * @return True if all routines returned the same inverse
+ */
+bool bench(uint64_t number_bits, uint64_t modulus_bits, std::mt19937_64 &gen) {
+    auto [number, modulus] = random_pair(number_bits, modulus_bits, gen);
+    auto expected = ROUTINES[0].inverse(number, modulus);
+
+    bool agree = true;
+    double reference = 0;
+    std::cout << number_bits << " / " << modulus_bits << " bits:";
+    for (auto &routine : ROUTINES) {
+        if (routine.inverse(number, modulus) != expected) {
+            std::cout << " " << routine.name << " returned a different inverse";
+            agree = false;
+        }
+        auto seconds = time_inverse(routine, number, modulus);
+        if (&routine == &ROUTINES[0])
+            reference = seconds;
+        std::cout << " " << routine.name << " " << seconds * 1e6 << " us (" << reference / seconds << "x)";
+    }
+    std::cout << std::endl;
+    return agree;
+}
+
+/**
+ * Main function
+ * Compares the modular inverse routines in my_big_int.h (textbook Euclid, Lehmer and binary) on random numbers
+ * as big as the modulus and on 31 bit numbers (the inverse of p in the knapsack)
+ * Usage: gcd_bench
+ * @return 0 if all routines agree
+ */
+int main() {
+    // Fixed seed, so all runs measure the same numbers
+    std::mt19937_64 gen(42);
+    bool agree = true;
+    for (auto bits : MODULUS_BITS)
+        agree &= bench(bits - 1, bits, gen);
+    for (auto bits : MODULUS_BITS)
+        agree &= bench(SMALL_NUMBER_BITS, bits, gen);
+    return agree ? EXIT_SUCCESS : EXIT_FAILURE;
+}
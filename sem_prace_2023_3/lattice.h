@@ -0,0 +1,413 @@
+#pragma once
+
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <cstdint>
+#include "my_big_int.h"
+
+/** Number of bits of the mantissa of double (tau in the Schnorr-Euchner LLL) */
+constexpr int DOUBLE_PRECISION = 53;
+/**
+ * Inner products of approximations smaller than this fraction of the product of the norms lost more than half
+ * of the bits to cancellation, they are computed exactly instead
+ */
+constexpr double CANCELLATION_BOUND = 1.0 / (1ull << (DOUBLE_PRECISION / 2));
+/** Size reduction coefficients bigger than this leave too few correct bits in mu, the step is repeated */
+constexpr double BIG_COEFFICIENT = 1ull << (DOUBLE_PRECISION / 2);
+/** Default delta of the Lovász condition */
+constexpr double LLL_DELTA = 0.99;
+/** Maximum number of bits of a basis entry (squares of the approximations have to fit into double) */
+constexpr uint64_t MAX_ENTRY_BITS = 500;
+
+/**
+ * Approximates MPInt with binary limbs by double (three most significant limbs are enough for 53 bits)
+ * @param num Number
+ * @tparam max_digits Maximum number of digits of the number
+ * @return Nearest double (truncated)
+ */
+template<ValidDigit T, T max_digits>
+double to_double(const MPInt<T, max_digits, BinaryLimbs> &num) {
+    const auto &limbs = num.getNumber();
+    double res = 0;
+    for (size_t i = limbs.size(), used = 0; i-- > 0 && used < 3; used++)
+        res += std::ldexp(static_cast<double>(limbs[i]), static_cast<int>(32 * i));
+    return num.getSign() < 0 ? -res : res;
+}
+
+/**
+ * Converts an integral double to MPInt (exactly, also above 2^63)
+ * @param value Integral value
+ * @tparam Num MPInt
+ * @return Number
+ */
+template<typename Num>
+Num integer_from_double(double value) {
+    if (std::abs(value) < 0x1p62)
+        return Num(static_cast<int64_t>(value));
+    int exponent;
+    const double mantissa = std::frexp(value, &exponent);
+    return Num(static_cast<int64_t>(std::ldexp(mantissa, DOUBLE_PRECISION))) <<
+           static_cast<uint64_t>(exponent - DOUBLE_PRECISION);
+}
+
+/**
+ * Floating point lattice basis reduction (LLL and BKZ of Schnorr and Euchner)
+ * The basis is kept exactly (MPInt vectors), Gram-Schmidt coefficients are computed from double approximations
+ * of the basis vectors, an inner product is computed exactly only if the approximate one lost too many bits
+ * to cancellation, so the big numbers are touched only by the row operations and these rare inner products
+ * Basis vectors are rows, linearly dependent rows are reduced to zero and removed
+ * @tparam Num MPInt with binary limbs
+ */
+template<typename Num>
+class LatticeReduction {
+private:
+    /** Basis vectors (rows) */
+    std::vector<std::vector<Num>> mBasis;
+    /** Approximations of the basis vectors */
+    std::vector<std::vector<double>> mApprox;
+    /** Squared norms of the approximations */
+    std::vector<double> mApproxNorms;
+    /** Gram-Schmidt coefficients (mMu[i][j] for j < i) */
+    std::vector<std::vector<double>> mMu;
+    /** Squared norms of the Gram-Schmidt vectors */
+    std::vector<double> mNorms;
+    /** Delta of the Lovász condition */
+    double mDelta;
+    /** Number of inner products computed exactly */
+    uint64_t mExactProducts;
+    /** Number of swaps of LLL */
+    uint64_t mSwaps;
+
+    /**
+     * Computes the approximation of a basis vector
+     * @param i Index of the vector
+     */
+    void refreshApprox(size_t i) {
+        double norm = 0;
+        for (size_t l = 0; l < mBasis[i].size(); l++) {
+            mApprox[i][l] = to_double(mBasis[i][l]);
+            norm += mApprox[i][l] * mApprox[i][l];
+        }
+        mApproxNorms[i] = norm;
+    }
+
+    /**
+     * Computes the inner product of two basis vectors exactly
+     * @param i Index of the first vector
+     * @param j Index of the second vector
+     * @return Approximation of the exact inner product
+     */
+    double exactProduct(size_t i, size_t j) {
+        mExactProducts++;
+        Num sum(0);
+        for (size_t l = 0; l < mBasis[i].size(); l++) {
+            if (!mBasis[i][l].isZero() && !mBasis[j][l].isZero())
+                sum += mBasis[i][l] * mBasis[j][l];
+        }
+        return to_double(sum);
+    }
+
+    /**
+     * Computes the Gram-Schmidt coefficients and the squared norm of the Gram-Schmidt vector of a basis vector
+     * (all previous vectors have to be computed already)
+     * @param k Index of the vector
+     */
+    void computeRow(size_t k) {
+        const auto &approx = mApprox[k];
+        double norm = mApproxNorms[k];
+        for (size_t j = 0; j < k; j++) {
+            double product = 0;
+            for (size_t l = 0; l < approx.size(); l++)
+                product += approx[l] * mApprox[j][l];
+            if (std::abs(product) < CANCELLATION_BOUND * std::sqrt(mApproxNorms[k] * mApproxNorms[j]))
+                product = exactProduct(k, j);
+
+            for (size_t i = 0; i < j; i++)
+                product -= mMu[j][i] * mMu[k][i] * mNorms[i];
+            mMu[k][j] = product / mNorms[j];
+            norm -= mMu[k][j] * mMu[k][j] * mNorms[j];
+        }
+        mNorms[k] = norm;
+    }
+
+    /**
+     * Subtracts a multiple of one basis vector from another one (exactly)
+     * @param k Index of the changed vector
+     * @param j Index of the subtracted vector
+     * @param coefficient Integral coefficient
+     */
+    void subtractMultiple(size_t k, size_t j, double coefficient) {
+        auto &target = mBasis[k];
+        const auto &source = mBasis[j];
+        const auto multiple = integer_from_double<Num>(coefficient);
+        for (size_t l = 0; l < target.size(); l++) {
+            if (source[l].isZero())
+                continue;
+            if (coefficient == 1)
+                target[l] -= source[l];
+            else if (coefficient == -1)
+                target[l] += source[l];
+            else
+                target[l] -= multiple * source[l];
+        }
+    }
+
+    /**
+     * Size reduces a basis vector by all previous vectors (|mu| <= 1/2)
+     * @param k Index of the vector
+     * @return True if a coefficient was too big and the Gram-Schmidt coefficients have to be computed again
+     */
+    bool sizeReduce(size_t k) {
+        bool changed = false, big = false;
+        for (size_t j = k; j-- > 0;) {
+            if (std::abs(mMu[k][j]) <= 0.5)
+                continue;
+            const double coefficient = std::round(mMu[k][j]);
+            big |= std::abs(coefficient) > BIG_COEFFICIENT;
+            subtractMultiple(k, j, coefficient);
+            for (size_t i = 0; i < j; i++)
+                mMu[k][i] -= coefficient * mMu[j][i];
+            mMu[k][j] -= coefficient;
+            changed = true;
+        }
+        if (changed)
+            refreshApprox(k);
+        return big;
+    }
+
+    /**
+     * Checks if a basis vector is zero
+     * @param k Index of the vector
+     * @return True if all entries are zero
+     */
+    [[nodiscard]] bool isZeroRow(size_t k) const {
+        return std::all_of(mBasis[k].begin(), mBasis[k].end(), [](const Num &entry) { return entry.isZero(); });
+    }
+
+    /**
+     * Removes a basis vector
+     * @param k Index of the vector
+     */
+    void eraseRow(size_t k) {
+        mBasis.erase(mBasis.begin() + static_cast<std::ptrdiff_t>(k));
+        mApprox.erase(mApprox.begin() + static_cast<std::ptrdiff_t>(k));
+        mApproxNorms.erase(mApproxNorms.begin() + static_cast<std::ptrdiff_t>(k));
+        mMu.erase(mMu.begin() + static_cast<std::ptrdiff_t>(k));
+        mNorms.erase(mNorms.begin() + static_cast<std::ptrdiff_t>(k));
+    }
+
+    /**
+     * Inserts a basis vector
+     * @param k Index of the new vector
+     * @param vector Vector
+     */
+    void insertRow(size_t k, std::vector<Num> vector) {
+        const auto offset = static_cast<std::ptrdiff_t>(k);
+        mBasis.insert(mBasis.begin() + offset, std::move(vector));
+        mApprox.insert(mApprox.begin() + offset, std::vector<double>(dimension()));
+        mApproxNorms.insert(mApproxNorms.begin() + offset, 0);
+        mMu.insert(mMu.begin() + offset, std::vector<double>());
+        mNorms.insert(mNorms.begin() + offset, 0);
+        for (auto &row : mMu)
+            row.resize(mBasis.size());
+        refreshApprox(k);
+    }
+
+    /**
+     * LLL reduction of the first vectors (the Gram-Schmidt data of the vectors before start has to be valid)
+     * @param start Index of the first vector that isn't reduced yet
+     * @param end Index after the last reduced vector
+     * @return Index after the last reduced vector (zero vectors were removed)
+     */
+    size_t lll(size_t start, size_t end) {
+        size_t k = start;
+        while (k < end) {
+            computeRow(k);
+            if (k > 0 && sizeReduce(k)) {
+                // Approximations of mu were too imprecise, the previous vector is checked again
+                k = std::max<size_t>(k - 1, 1);
+                continue;
+            }
+            if (isZeroRow(k)) {
+                eraseRow(k);
+                end--;
+                continue;
+            }
+            if (k > 0) {
+                // Size reduction keeps the Gram-Schmidt vector, so its norm is still valid
+                const double mu = mMu[k][k - 1];
+                if (mDelta * mNorms[k - 1] > mNorms[k] + mu * mu * mNorms[k - 1]) {
+                    std::swap(mBasis[k], mBasis[k - 1]);
+                    std::swap(mApprox[k], mApprox[k - 1]);
+                    std::swap(mApproxNorms[k], mApproxNorms[k - 1]);
+                    mSwaps++;
+                    k = std::max<size_t>(k - 1, 1);
+                    if (k == 1)
+                        computeRow(0);
+                    continue;
+                }
+            }
+            k++;
+        }
+        return end;
+    }
+
+    /**
+     * Finds the shortest vector of the projected block (enumeration of Schnorr and Euchner, zig-zag around
+     * the centers, only one of v and -v is visited)
+     * @param first Index of the first vector of the block
+     * @param last Index of the last vector of the block
+     * @param coefficients Coefficients of the shortest vector in the block (the result is stored here)
+     * @return Squared norm of the projection of the shortest vector
+     */
+    double enumerate(size_t first, size_t last, std::vector<int64_t> &coefficients) {
+        const size_t size = last + 2;
+        std::vector<double> partial(size, 0), centers(size, 0);
+        std::vector<int64_t> current(size, 0), rounded(size, 0), step(size, 0), direction(size, 1);
+        coefficients.assign(last - first + 1, 0);
+        coefficients[0] = 1;
+        current[first] = 1;
+
+        double best = mNorms[first];
+        size_t top = first, t = first;
+        while (t <= last) {
+            const double offset = centers[t] + static_cast<double>(current[t]);
+            partial[t] = partial[t + 1] + offset * offset * mNorms[t];
+            if (partial[t] < best) {
+                if (t > first) {
+                    t--;
+                    double center = 0;
+                    for (size_t i = t + 1; i <= top; i++)
+                        center += static_cast<double>(current[i]) * mMu[i][t];
+                    centers[t] = center;
+                    current[t] = rounded[t] = static_cast<int64_t>(std::round(-center));
+                    step[t] = 0;
+                    direction[t] = static_cast<double>(current[t]) > -center ? -1 : 1;
+                } else {
+                    best = partial[first];
+                    for (size_t i = first; i <= last; i++)
+                        coefficients[i - first] = current[i];
+                }
+            } else {
+                t++;
+                top = std::max(top, t);
+                if (t < top)
+                    step[t] = -step[t];
+                if (step[t] * direction[t] >= 0)
+                    step[t] += direction[t];
+                current[t] = rounded[t] + step[t];
+            }
+        }
+        return best;
+    }
+
+public:
+    /**
+     * Constructor for the LatticeReduction class
+     * @param basis Basis vectors (rows of the same dimension, entries have at most MAX_ENTRY_BITS bits)
+     * @param delta Delta of the Lovász condition (between 1/4 and 1)
+     */
+    explicit LatticeReduction(std::vector<std::vector<Num>> basis, double delta = LLL_DELTA) :
+            mBasis(std::move(basis)), mApprox(), mApproxNorms(), mMu(), mNorms(), mDelta(delta), mExactProducts(0),
+            mSwaps(0) {
+        if (mBasis.empty())
+            throw std::invalid_argument("Lattice basis is empty");
+        if (delta <= 0.25 || delta >= 1)
+            throw std::invalid_argument("Delta of the Lovász condition has to be between 1/4 and 1");
+        for (auto &row : mBasis) {
+            if (row.size() != mBasis[0].size())
+                throw std::invalid_argument("Basis vectors have different dimensions");
+            for (auto &entry : row) {
+                if (entry.bitLength() > MAX_ENTRY_BITS)
+                    throw std::invalid_argument("Basis entry with " + std::to_string(entry.bitLength()) +
+                                                " bits can't be approximated by double");
+            }
+        }
+
+        mApprox.assign(mBasis.size(), std::vector<double>(dimension()));
+        mApproxNorms.assign(mBasis.size(), 0);
+        mMu.assign(mBasis.size(), std::vector<double>(mBasis.size(), 0));
+        mNorms.assign(mBasis.size(), 0);
+        for (size_t i = 0; i < mBasis.size(); i++)
+            refreshApprox(i);
+    }
+
+    /**
+     * LLL reduction of the whole basis
+     */
+    void lll() {
+        lll(0, mBasis.size());
+    }
+
+    /**
+     * BKZ reduction of the whole basis (blocks are enumerated until a whole tour inserts no vector)
+     * @param block_size Size of the blocks (2 is LLL)
+     */
+    void bkz(size_t block_size) {
+        lll();
+        if (block_size < 2 || mBasis.size() < 2)
+            return;
+
+        std::vector<int64_t> coefficients;
+        size_t unchanged = 0, first = mBasis.size() - 2;
+        while (unchanged < mBasis.size() - 1) {
+            first = (first + 1) % (mBasis.size() - 1);
+            const size_t last = std::min(first + block_size - 1, mBasis.size() - 1);
+            const size_t end = std::min(last + 2, mBasis.size());
+            const double norm = enumerate(first, last, coefficients);
+
+            if (norm < mDelta * mNorms[first]) {
+                // Shortest vector of the block is inserted before the block, LLL removes the dependency
+                unchanged = 0;
+                std::vector<Num> vector(dimension(), Num(0));
+                for (size_t i = 0; i < coefficients.size(); i++) {
+                    if (!coefficients[i])
+                        continue;
+                    const Num multiple(coefficients[i]);
+                    for (size_t l = 0; l < dimension(); l++)
+                        vector[l] += multiple * mBasis[first + i][l];
+                }
+                insertRow(first, std::move(vector));
+                lll(first, end + 1);
+            } else {
+                unchanged++;
+                lll(end - 1, end);
+            }
+        }
+    }
+
+    /**
+     * Getter for the basis
+     * @return Basis vectors (rows)
+     */
+    [[nodiscard]] const std::vector<std::vector<Num>> &getBasis() const {
+        return mBasis;
+    }
+
+    /**
+     * Getter for the dimension of the basis vectors
+     * @return Dimension
+     */
+    [[nodiscard]] size_t dimension() const {
+        return mBasis[0].size();
+    }
+
+    /**
+     * Getter for the number of inner products computed exactly
+     * @return Number of exact inner products
+     */
+    [[nodiscard]] uint64_t getExactProducts() const {
+        return mExactProducts;
+    }
+
+    /**
+     * Getter for the number of swaps
+     * @return Number of swaps
+     */
+    [[nodiscard]] uint64_t getSwaps() const {
+        return mSwaps;
+    }
+};
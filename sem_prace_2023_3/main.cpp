@@ -1,9 +1,14 @@
 #include <iostream>
-#include <random>
-#include <chrono>
 #include <fstream>
 #include <filesystem>
-#include "my_big_int.h"
+#include <thread>
+#include <bit>
+#include <array>
+#include <numeric>
+#include "bignum_mpint.h"
+#include "container.h"
+#include "csprng.h"
+#include "fixed_int.h"
 
 /** Size of the key in bits */
 constexpr int KEY_SIZE = 250;
@@ -13,37 +18,42 @@ constexpr std::string_view DATA_SOURCE = "validation/";
 constexpr std::string_view OUTPUT_DIR = "out/";
 /** Directory where the decoded data is stored */
 constexpr std::string_view DECODED_DIR = "decoded/";
-/** 0, 1 and 2 in MPInt */
-MPInt<int32_t, UNLIMITED> ZERO("0"),
-                          ONE("1"),
-                          TWO("2");
-/** Vector of powers of 2 */
-std::vector<MPInt<int32_t, UNLIMITED>> TWO_POWS;
-
+/** Container with the keys (keys are generated only if it doesn't exist) */
+constexpr std::string_view KEYS_FILE = "keys.bin";
 /**
- * Initializes the vector of powers of 2
- * @param size Size of the vector (max power of 2)
+ * Big integer used by the knapsack (binary limbs, so the conversions from and to bits are linear)
  */
-void init_two_pows(int size) {
-    TWO_POWS.push_back(ONE);
-    for (int i = 1; i < size; i++)
-        TWO_POWS.push_back(TWO_POWS[i - 1] * TWO);
-}
+using BigInt = MPInt<int32_t, UNLIMITED, BinaryLimbs>;
+/** Number of random bits of every step of the private key (see gen_private_key()) */
+constexpr int PRIVATE_KEY_STEP_BITS = 100;
+/** Number of random bits added to the sum of the private key to get q (see gen_q()) */
+constexpr int Q_RANDOM_BITS = 350;
+/**
+ * Upper bound of the number of bits of q
+ * Element i of the private key is smaller than 2^(PRIVATE_KEY_STEP_BITS + i + 1), so their sum is smaller than
+ * 2^(PRIVATE_KEY_STEP_BITS + KEY_SIZE + 1) and q adds Q_RANDOM_BITS random bits and 1 to it
+ */
+constexpr int Q_BITS = std::max(Q_RANDOM_BITS, PRIVATE_KEY_STEP_BITS + KEY_SIZE + 1) + 1;
+/** Upper bound of the number of bits of an encoded block (sum of at most KEY_SIZE elements of the public key < q) */
+constexpr int BLOCK_BITS = Q_BITS + std::bit_width(static_cast<unsigned>(KEY_SIZE));
+/** Fixed-width integer holding every encoded block (384 bits for the key size 250) */
+using BlockInt = FixedInt<(BLOCK_BITS + 63) / 64>;
+/** Number of key positions in one group of the encode table */
+constexpr int GROUP_BITS = 8;
+/** Number of subset sums of one group of the encode table */
+constexpr int GROUP_SUMS = 1 << GROUP_BITS;
+/** Number of groups of the encode table (the last group can be shorter) */
+constexpr int GROUP_COUNT = (KEY_SIZE + GROUP_BITS - 1) / GROUP_BITS;
+/** 1 in MPInt (constructed at compile time) */
+constexpr BigInt ONE(1);
 
 /**
  * Converts a vector of bits to a decimal number (MPInt)
  * @param bits Vector of bits
  * @return MPInt representation of the bits
  */
-MPInt<int32_t, UNLIMITED> bits_to_dec(const std::vector<bool> &bits) {
-    MPInt<int32_t, UNLIMITED> res("0");
-    auto bits_reverse{bits};
-    std::reverse(bits_reverse.begin(), bits_reverse.end());
-    for (int i = 0; i < bits_reverse.size(); i++) {
-        if (bits_reverse[i])
-            res += TWO_POWS[i];
-    }
-    return res;
+BigInt bits_to_dec(const std::vector<bool> &bits) {
+    return BigInt::fromBits(bits);
 }
 
 /**
@@ -51,44 +61,8 @@ MPInt<int32_t, UNLIMITED> bits_to_dec(const std::vector<bool> &bits) {
  * @param dec MPInt representation of the bits
  * @return Vector of bits
  */
-std::vector<bool> dec_to_bits(MPInt<int32_t, UNLIMITED> dec) {
-    std::vector<bool> res;
-    while (dec > ZERO) {
-        res.push_back(dec % TWO == ONE);
-        dec /= TWO;
-    }
-    std::reverse(res.begin(), res.end());
-    return res;
-}
-
-/**
- * Generates a vector of random bits
- * @param size Size of the vector
- * @return Vector of random bits
- */
-std::vector<bool> gen_rng_bits(int size) {
-    std::default_random_engine gen(std::chrono::system_clock::now().time_since_epoch().count());
-    std::uniform_int_distribution<int> dist(0, 1);
-    std::vector<bool> res;
-    for (int i = 0; i < size; ++i)
-        res.push_back(dist(gen));
-    return res;
-}
-
-/**
- * Checks if a number is prime and bigger than 2
- * @param n Number to check
- * @return True if the number is prime and bigger than 2, false otherwise
- */
-bool is_prime_and_bigger_than_two(int n) {
-    if (n <= 2)
-        return false;
-    if (n % 2 == 0 || n % 3 == 0)
-        return false;
-    for (int i = 5; i * i <= n; i += 6)
-        if (n % i == 0 || n % (i + 2) == 0)
-            return false;
-    return true;
+std::vector<bool> dec_to_bits(const BigInt &dec) {
+    return dec.toBits();
 }
 
 /**
@@ -97,27 +71,22 @@ bool is_prime_and_bigger_than_two(int n) {
  * @return Random prime number between 3 and upper_limit
  */
 int gen_prime(int upper_limit=INT32_MAX) {
-    std::default_random_engine gen(std::chrono::system_clock::now().time_since_epoch().count());
-    std::uniform_int_distribution<int> dist(0, upper_limit);
-    int res = dist(gen);
-    while (!is_prime_and_bigger_than_two(res))
-        res = dist(gen);
-    return res;
+    return static_cast<int>(random_prime(upper_limit));
 }
 
 /**
  * Generates a private key (it is sure that the sequence is super increasing)
- * @return Private key
+ * @return Private key in decimal form
  */
-std::vector<std::vector<bool>> gen_private_key() {
-    std::vector<std::vector<bool>> res(KEY_SIZE);
-    MPInt<int32_t, UNLIMITED> sum("0");
+std::vector<BigInt> gen_private_key() {
+    std::vector<BigInt> res(KEY_SIZE);
+    BigInt sum(0);
     for (int i = 0; i < KEY_SIZE; i++) {
-        // Generate a random number between 0 and 2^100 and add it to the sum of the previous numbers
+        // Generate a random number between 0 and 2^PRIVATE_KEY_STEP_BITS and add it to the sum of the previous numbers
         // This ensures that the sequence is super increasing (thus the + 1)
-        MPInt<int32_t, UNLIMITED> next = bits_to_dec(gen_rng_bits(100)) + sum + ONE;
+        BigInt next = random_bits<BigInt>(PRIVATE_KEY_STEP_BITS) + sum + ONE;
         sum += next;
-        res[i] = dec_to_bits(next);
+        res[i] = std::move(next);
     }
     return res;
 }
@@ -127,11 +96,11 @@ std::vector<std::vector<bool>> gen_private_key() {
  * @param private_key_dec Private key in decimal form
  * @return q parameter
  */
-std::vector<bool> gen_q(const std::vector<MPInt<int32_t, UNLIMITED>> &private_key_dec) {
-    MPInt<int32_t, UNLIMITED> cum_sum("0");
+std::vector<bool> gen_q(const std::vector<BigInt> &private_key_dec) {
+    BigInt cum_sum(0);
     for (auto &key : private_key_dec)
         cum_sum += key;
-    MPInt<int32_t, UNLIMITED> q = bits_to_dec(gen_rng_bits(350)) + cum_sum + ONE;
+    BigInt q = random_bits<BigInt>(Q_RANDOM_BITS) + cum_sum + ONE;
     return dec_to_bits(q);
 }
 
@@ -140,147 +109,389 @@ std::vector<bool> gen_q(const std::vector<MPInt<int32_t, UNLIMITED>> &private_ke
  * @param private_key_dec Private key in decimal form
  * @param p P parameter
  * @param q Q parameter
- * @return Public key
+ * @return Public key in decimal form
  */
-std::vector<std::vector<bool>> gen_public_key(const std::vector<MPInt<int32_t, UNLIMITED>> &private_key_dec, int p, const std::vector<bool> &q) {
-    std::vector<std::vector<bool>> res(KEY_SIZE);
-    MPInt<int32_t, UNLIMITED> q_dec = bits_to_dec(q);
-    MPInt<int32_t, UNLIMITED> p_dec(std::to_string(p));
-    for (int i = 0; i < KEY_SIZE; i++) {
-        auto private_key_dec_i = private_key_dec[i];
-        auto public_key_dec = (private_key_dec_i * p_dec) % q_dec;
-        res[i] = dec_to_bits(public_key_dec);
-    }
+std::vector<BigInt> gen_public_key(const std::vector<BigInt> &private_key_dec, int p, const std::vector<bool> &q) {
+    std::vector<BigInt> res(KEY_SIZE);
+    ModContext q_mod(bits_to_dec(q)); // Same modulus for all the key elements
+    BigInt p_dec(p);
+    for (int i = 0; i < KEY_SIZE; i++)
+        res[i] = q_mod.mulmod(private_key_dec[i], p_dec);
     return res;
 }
 
 /**
- * Non recursive implementation of the extended euclidean algorithm
- * @param a Number to find the multiplicative inverse of
- * @param b Modulo number (the number to find the multiplicative inverse of a modulo b)
- * @return Multiplicative inverse of a modulo b
+ * Generates p inverse parameter
+ * @param p P parameter
+ * @param q Q parameter
+ * @return p inverse parameter
+ */
+BigInt gen_p_inverse(int p, const std::vector<bool>& q) {
+    // Lehmer's extended euclidean algorithm (see ext_gcd_lehmer_digits() in my_big_int.h)
+    return mod_inverse(BigInt(p), bits_to_dec(q));
+}
+
+/**
+ * Splits the range [0, count) to consecutive ranges and processes them by all available threads
+ * @param count Number of items
+ * @param alignment Every range except the last one starts and ends at a multiple of the alignment
+ * @param work Function processing the range [first, last) (called once per range, every range in its own thread)
+ * @tparam F Type of the function
+ */
+template<typename F>
+void parallel_ranges(size_t count, size_t alignment, F work) {
+    const size_t thread_count = std::max(1u, std::thread::hardware_concurrency());
+    const size_t aligned_count = (count + alignment - 1) / alignment;
+    const size_t per_thread = (aligned_count + thread_count - 1) / thread_count * alignment;
+
+    std::vector<std::thread> threads;
+    for (size_t first = 0; first < count; first += per_thread)
+        threads.emplace_back(work, first, std::min(first + per_thread, count));
+    for (auto &thread: threads)
+        thread.join();
+}
+
+/**
+ * Precomputed subset sums of the public key (method of four Russians)
+ * Key positions are split to groups of GROUP_BITS positions and the table holds the sums of all subsets of every group,
+ * so a block is encoded with one addition per group instead of one addition per set bit
+ * Sums are fixed-width (BlockInt), so the table is one contiguous array and every addition is straight-line code
  */
-MPInt<int32_t, UNLIMITED> find_multiplicative_inverse(MPInt<int32_t, UNLIMITED> a, MPInt<int32_t, UNLIMITED> b) {
-    MPInt<int32_t, UNLIMITED> x1("0"), y1("1"), x("1"), y("0");
-    while (a != ZERO) {
-        MPInt<int32_t, UNLIMITED> q = b / a;
-        MPInt<int32_t, UNLIMITED> t = a;
-        a = b % a;
-        b = t;
-        t = x;
-        x = x1 - q * x;
-        x1 = t;
-        t = y;
-        y = y1 - q * y;
-        y1 = t;
+struct EncodeTable {
+    /** Subset sums, sums[group * GROUP_SUMS + mask], bit k of mask stands for key position group * GROUP_BITS + k */
+    std::vector<BlockInt> sums;
+};
+
+/**
+ * Fills the subset sums of the given groups of the encode table
+ * Every sum is the sum of the mask without its lowest bit plus the key element of that bit (one addition per sum)
+ * @param table Encode table (already resized)
+ * @param public_key Public key in the fixed-width form
+ * @param first_group First group to fill
+ * @param last_group Group after the last group to fill
+ */
+void fill_encode_table(EncodeTable &table, const std::vector<BlockInt> &public_key, int first_group, int last_group) {
+    for (int group = first_group; group < last_group; group++) {
+        auto *sums = table.sums.data() + group * GROUP_SUMS;
+        sums[0] = BlockInt();
+        for (int mask = 1; mask < GROUP_SUMS; mask++) {
+            auto position = group * GROUP_BITS + std::countr_zero(static_cast<unsigned int>(mask));
+            // Positions after the end of the key (last group) don't change the sum
+            if (position < KEY_SIZE)
+                sums[mask] = sums[mask & (mask - 1)] + public_key[position];
+            else
+                sums[mask] = sums[mask & (mask - 1)];
+        }
     }
-    return x1;
 }
 
 /**
- * Generates p inverse parameter
- * @param p P parameter
- * @param q Q parameter
- * @return p inverse parameter
+ * Builds the encode table for the public key, groups are filled by all available threads
+ * @param public_key_dec Public key in decimal form
+ * @return Encode table
+ */
+EncodeTable build_encode_table(const std::vector<BigInt> &public_key_dec) {
+    // Every element of the public key is smaller than q, the conversion throws if it doesn't fit
+    std::vector<BlockInt> public_key(public_key_dec.begin(), public_key_dec.end());
+    EncodeTable table;
+    table.sums.resize(GROUP_COUNT * GROUP_SUMS);
+
+    parallel_ranges(GROUP_COUNT, 1, [&](size_t first_group, size_t last_group) {
+        fill_encode_table(table, public_key, static_cast<int>(first_group), static_cast<int>(last_group));
+    });
+
+    return table;
+}
+
+/**
+ * Computes the memory used by the encode table (fixed-width sums have nothing on the heap)
+ * @param table Encode table
+ * @return Number of bytes
+ */
+size_t encode_table_memory(const EncodeTable &table) {
+    return table.sums.capacity() * sizeof(BlockInt);
+}
+
+/** Number of blocks after which a block starts at the beginning of a byte (ranges of decoded blocks don't share bytes) */
+constexpr size_t BYTE_ALIGNED_BLOCKS = 8 / std::gcd(KEY_SIZE, 8);
+
+/**
+ * Reverses the order of the bits of a byte
+ * @param byte Byte
+ * @return Byte with the reversed bits
+ */
+constexpr uint64_t reverse_byte(unsigned char byte) {
+    uint64_t res = 0;
+    for (int i = 0; i < 8; i++)
+        res |= static_cast<uint64_t>((byte >> i) & 1) << (7 - i);
+    return res;
+}
+
+/**
+ * Extracts bits from packed bits (bit p is the bit p % 64 of the word p / 64)
+ * @param words Packed bits (one word has to follow the extracted bits)
+ * @param position Position of the first bit
+ * @param count Number of bits (less than 64)
+ * @return Extracted bits, the first one is the least significant bit
  */
-MPInt<int32_t, UNLIMITED> gen_p_inverse(int p, const std::vector<bool>& q) {
-    MPInt<int32_t, UNLIMITED> p_dec(std::to_string(p));
-    MPInt<int32_t, UNLIMITED> q_dec = bits_to_dec(q);
-    return q_dec + find_multiplicative_inverse(p_dec, q_dec);
+uint64_t extract_bits(const std::vector<uint64_t> &words, size_t position, int count) {
+    auto word = position / 64;
+    auto shift = position % 64;
+    uint64_t bits = words[word] >> shift;
+    if (shift + count > 64)
+        bits |= words[word + 1] << (64 - shift);
+    return bits & ((1ull << count) - 1);
 }
 
 /**
  * Encodes bytes into a vector of integers
+ * Input bits are packed to 64 bit words (the most significant bit of every byte first), bits of every group of the
+ * encode table are extracted with shifts
+ * Ranges of blocks are encoded by all available threads, every block is stored at its index, so the order is preserved
+ * Sum of a block is fixed-width (BlockInt is big enough for any block, no carry leaves it)
  * @param input_bytes Input bytes
- * @param public_key_dec Public key in decimal form
+ * @param table Encode table of the public key (see build_encode_table())
  * @param padding Padding of the input bits (number is modified)
  * @return Vector of encoded integers (in decimal form) (MPInt)
  */
-std::vector<MPInt<int32_t, UNLIMITED>> encode(const std::vector<unsigned char> &input_bytes, const std::vector<MPInt<int32_t, UNLIMITED>> &public_key_dec, int *padding) {
-    std::vector<bool> input_bits;
-    for (auto &byte : input_bytes) {
-        std::vector<bool> byte_bits;
-        for (int i = 0; i < 8; i++)
-            byte_bits.push_back((byte >> i) & 1);
-        std::reverse(byte_bits.begin(), byte_bits.end());
-        input_bits.insert(input_bits.end(), byte_bits.begin(), byte_bits.end());
-    }
+std::vector<BigInt> encode(const std::vector<unsigned char> &input_bytes, const EncodeTable &table, int *padding) {
+    const size_t input_bits = input_bytes.size() * 8;
+    const size_t block_count = (input_bits + KEY_SIZE - 1) / KEY_SIZE;
+    *padding += static_cast<int>(block_count * KEY_SIZE - input_bits);
+
+    // Bit p of the input is the bit p % 64 of the word p / 64, padding bits stay zero
+    std::vector<uint64_t> words((block_count * KEY_SIZE + 63) / 64 + 1, 0);
+    for (size_t i = 0; i < input_bytes.size(); i++)
+        words[i / 8] |= reverse_byte(input_bytes[i]) << (i % 8 * 8);
+
+    std::vector<BigInt> res(block_count);
+    parallel_ranges(block_count, 1, [&](size_t first_block, size_t last_block) {
+        for (size_t block = first_block; block < last_block; block++) {
+            BlockInt sum;
+            for (int group = 0; group < GROUP_COUNT; group++) {
+                auto mask = extract_bits(words, block * KEY_SIZE + group * GROUP_BITS,
+                                         std::min(GROUP_BITS, KEY_SIZE - group * GROUP_BITS));
+                // Sum of the empty subset is zero, so the mask doesn't have to be checked
+                sum += table.sums[group * GROUP_SUMS + mask];
+            }
+            res[block] = sum.to<BigInt>();
+        }
+    });
+
+    return res;
+}
+
+/**
+ * Run of consecutive elements of the private key with the same number of words
+ */
+struct PrivateKeyRun {
+    /** Index of the first element of the run */
+    int first;
+    /** Index after the last element of the run */
+    int last;
+    /** Number of words of the elements */
+    size_t words;
+};
+
+/**
+ * Private key prepared for decoding (fixed-width elements and their runs by the number of words)
+ */
+struct DecodeKey {
+    /** Elements of the private key */
+    std::vector<BlockInt> elements;
+    /** Runs of the elements with the same number of words (from the first element) */
+    std::vector<PrivateKeyRun> runs;
+};
 
-    while (input_bits.size() % KEY_SIZE) {
-        input_bits.push_back(false);
-        (*padding)++;
+/**
+ * Prepares the private key for decoding
+ * @param private_key_dec Private key in decimal form (every element fits into BlockInt, it's smaller than q)
+ * @return Private key prepared for decoding
+ */
+DecodeKey build_decode_key(const std::vector<BigInt> &private_key_dec) {
+    DecodeKey key{std::vector<BlockInt>(private_key_dec.begin(), private_key_dec.end()), {}};
+    for (int i = 0; i < KEY_SIZE; i++) {
+        auto words = key.elements[i].wordLength();
+        if (key.runs.empty() || key.runs.back().words != words)
+            key.runs.push_back({i, i, words});
+        key.runs.back().last = i + 1;
     }
+    return key;
+}
 
-    std::vector<MPInt<int32_t, UNLIMITED>> res;
-    for (int i = 0; i < input_bits.size(); i += KEY_SIZE) {
-        MPInt<int32_t, UNLIMITED> sum("0");
-        for (int j = 0; j < KEY_SIZE; j++) {
-            if (input_bits[i + j])
-                sum += public_key_dec[j];
-        }
-        res.push_back(sum);
+/**
+ * Decodes elements of one run by the greedy algorithm (from the last element down to the first one)
+ * Every element is subtracted from a copy of the remainder (trial subtraction) and the borrow selects whether the
+ * difference is kept, so there is no data dependent branch, only the lowest Active words are touched
+ * @param remainder Remainder of the block (has at most Active words, the result is stored here)
+ * @param key Private key prepared for decoding
+ * @param run Run of the elements (with at most Active words)
+ * @param first_bit Position of the first bit of the block in the output
+ * @param output Output bytes
+ * @tparam Active Number of the lowest words of the remainder and the elements that are used
+ */
+template<size_t Active>
+void decode_run(BlockInt &remainder, const DecodeKey &key, const PrivateKeyRun &run, size_t first_bit,
+                unsigned char *output) {
+    // Local copies stay in registers (output bytes may alias anything, so the references would be reloaded every time)
+    auto current = remainder;
+    const BlockInt *elements = key.elements.data();
+    for (int i = run.last - 1; i >= run.first; i--) {
+        auto rest = current;
+        const uint64_t borrow = rest.subIn<Active>(elements[i]);
+        current.select<Active>(rest, !borrow);
+        auto position = first_bit + i;
+        output[position / 8] |= static_cast<unsigned char>((borrow ^ 1) << (7 - position % 8));
     }
+    remainder = current;
+}
 
-    return res;
+/** decode_run() for all numbers of active words (index 0 uses 1 word) */
+constexpr auto DECODE_RUN = []<size_t... I>(std::index_sequence<I...>) {
+    return std::array{&decode_run<I + 1>...};
+}(std::make_index_sequence<BlockInt::BITS / 64>{});
+
+/**
+ * Decodes one block by the greedy algorithm (the private key is super increasing)
+ * The remainder never grows, so the words it uses at the start of a run are enough for the whole run and the carry
+ * chains are only as long as the bigger of the remainder and the elements (2 words for the first elements instead of 6)
+ * Recovered bits are set straight in the output bytes (bit i of the block is the bit (7 - p % 8) of the byte p / 8,
+ * where p = first_bit + i)
+ * @param remainder Block multiplied by p inverse modulo q
+ * @param key Private key prepared for decoding
+ * @param first_bit Position of the first bit of the block in the output
+ * @param output Output bytes
+ */
+void decode_block(BlockInt remainder, const DecodeKey &key, size_t first_bit, unsigned char *output) {
+    for (auto run = key.runs.rbegin(); run != key.runs.rend(); ++run) {
+        auto active = std::max(run->words, remainder.wordLength());
+        DECODE_RUN[active - 1](remainder, key, *run, first_bit, output);
+    }
 }
 
 /**
  * Decodes a vector of integers into bytes
- * @param input Input vector of integers (in decimal form) (MPInt)
+ * Every block is multiplied by p inverse modulo q and decoded by decode_block(), the private key is prepared once
+ * (see build_decode_key())
+ * Ranges of blocks are decoded by all available threads, ranges start at BYTE_ALIGNED_BLOCKS, so no output byte is
+ * written by two threads
+ * Blocks are read straight from the ciphertext container, the padding is stored in its header
+ * @param input Ciphertext container
  * @param private_key_dec Private key in decimal form
  * @param p_inverse P inverse parameter
  * @param q Q parameter
- * @param padding Padding of the input bits (number was modified while encoding)
  * @return Decoded bytes
  */
-std::vector<unsigned char> decode(std::vector<MPInt<int32_t, UNLIMITED>> &input, const std::vector<MPInt<int32_t, UNLIMITED>> &private_key_dec, MPInt<int32_t, UNLIMITED> &p_inverse, const std::vector<bool> &q, int padding) {
-    auto q_dec = bits_to_dec(q);
-    std::vector<bool> res_bits;
-    std::vector<unsigned char> res;
-
-    for (auto &input_dec : input) {
-        auto temp = (input_dec * p_inverse) % q_dec;
-        std::vector<bool> bits(KEY_SIZE);
-        for (int i = KEY_SIZE - 1; i >= 0; i--) {
-            if (temp >= private_key_dec[i]) {
-                bits[i] = true;
-                temp -= private_key_dec[i];
-            }
+std::vector<unsigned char> decode(const MappedContainer<int32_t, UNLIMITED> &input, const std::vector<BigInt> &private_key_dec, const BigInt &p_inverse, const std::vector<bool> &q) {
+    ModContext q_mod(bits_to_dec(q)); // Same modulus for all the blocks
+    auto p_inverse_reduced = q_mod.reduce(p_inverse);
+    auto private_key = build_decode_key(private_key_dec);
+    // Padding bits are zeros at the end, so they fall to the bytes cut off at the end
+    std::vector<unsigned char> res((input.size() * KEY_SIZE + 7) / 8, 0);
+
+    parallel_ranges(input.size(), BYTE_ALIGNED_BLOCKS, [&](size_t first_block, size_t last_block) {
+        for (size_t block = first_block; block < last_block; block++) {
+            BlockInt remainder(q_mod.mulmod(input.number(block), p_inverse_reduced));
+            decode_block(remainder, private_key, block * KEY_SIZE, res.data());
         }
-        res_bits.insert(res_bits.end(), bits.begin(), bits.end());
-    }
+    });
+
+    res.resize((input.size() * KEY_SIZE - input.getPadding()) / 8);
+    return res;
+}
 
-    while (padding--)
-        res_bits.pop_back();
+/**
+ * Keys of the knapsack (everything needed for encoding and decoding)
+ */
+struct KnapsackKeys {
+    /** P parameter */
+    BigInt p;
+    /** Q parameter */
+    std::vector<bool> q;
+    /** P inverse parameter */
+    BigInt p_inverse;
+    /** Private key in decimal form */
+    std::vector<BigInt> private_key_dec;
+    /** Public key in decimal form */
+    std::vector<BigInt> public_key_dec;
+};
+
+/**
+ * Generates new keys
+ * @return Keys
+ */
+KnapsackKeys gen_keys() {
+    KnapsackKeys keys;
+    keys.private_key_dec = gen_private_key();
+    keys.q = gen_q(keys.private_key_dec);
+    auto p = gen_prime(); // This ensures that p and q don't have common factors (except 1)
+    keys.p = BigInt(p);
+    keys.public_key_dec = gen_public_key(keys.private_key_dec, p, keys.q);
+    keys.p_inverse = gen_p_inverse(p, keys.q); // This always exists, because p is prime and q is whatever really
+    return keys;
+}
+
+/**
+ * Saves the keys to the container
+ * Numbers are stored in the order p, q, p inverse, private key, public key
+ * @param filepath Filepath of the container
+ * @param keys Keys
+ * @return True if the keys were written, false otherwise
+ */
+bool save_keys(const std::string &filepath, const KnapsackKeys &keys) {
+    std::vector<BigInt> numbers{keys.p, bits_to_dec(keys.q), keys.p_inverse};
+    numbers.insert(numbers.end(), keys.private_key_dec.begin(), keys.private_key_dec.end());
+    numbers.insert(numbers.end(), keys.public_key_dec.begin(), keys.public_key_dec.end());
+    return save_container(filepath, ContainerKind::KEYS, KEY_SIZE, 0, numbers);
+}
 
-    for (int i = 0; i < res_bits.size(); i += 8) {
-        unsigned char byte = 0;
-        for (int j = 0; j < 8; j++)
-            byte |= res_bits[i + j] << (7 - j);
-        res.push_back(byte);
+/**
+ * Loads the keys from the container (see save_keys())
+ * @param filepath Filepath of the container
+ * @param keys Keys (output)
+ * @return True if the keys were loaded, false otherwise
+ */
+bool load_keys(const std::string &filepath, KnapsackKeys *keys) {
+    MappedContainer<int32_t, UNLIMITED> container(filepath, ContainerKind::KEYS);
+    if (!container.isOpen())
+        return false;
+    if (container.getKeySize() != KEY_SIZE || container.size() != 3 + 2 * KEY_SIZE) {
+        std::cout << "Keys in " << filepath << " are not for the key size " << KEY_SIZE << std::endl;
+        return false;
     }
 
-    return res;
+    keys->p = container.number(0);
+    keys->q = dec_to_bits(container.number(1));
+    keys->p_inverse = container.number(2);
+    keys->private_key_dec.clear();
+    keys->public_key_dec.clear();
+    for (int i = 0; i < KEY_SIZE; i++) {
+        keys->private_key_dec.push_back(container.number(3 + i));
+        keys->public_key_dec.push_back(container.number(3 + KEY_SIZE + i));
+    }
+    return true;
 }
 
 /**
  * Main function
  */
 int main() {
-    init_two_pows(400); // Initialize vector of powers of 2
-    std::cout << "Generating keys..." << std::endl;
-    auto private_key = gen_private_key();
-    std::vector<MPInt<int32_t, UNLIMITED>> private_key_dec;
-    for (auto &key : private_key)
-        private_key_dec.push_back(bits_to_dec(key));
-    auto q = gen_q(private_key_dec);
-    auto p = gen_prime(); // This ensures that p and q don't have common factors (except 1)
-    auto public_key = gen_public_key(private_key_dec, p, q);
-    std::vector<MPInt<int32_t, UNLIMITED>> public_key_dec;
-    for (auto &key : public_key)
-        public_key_dec.push_back(bits_to_dec(key));
-    auto p_inverse = gen_p_inverse(p, q); // This always exists, because p is prime and q is whatever really
+    KnapsackKeys keys;
+    if (std::filesystem::exists(KEYS_FILE) && load_keys(std::string(KEYS_FILE), &keys)) {
+        std::cout << "Keys have been loaded from " << KEYS_FILE << std::endl;
+    } else {
+        std::cout << "Generating keys..." << std::endl;
+        keys = gen_keys();
+        save_keys(std::string(KEYS_FILE), keys);
+    }
+    const auto &[p, q, p_inverse, private_key_dec, public_key_dec] = keys;
+
+    // Subset sums of the public key are shared by all the encoded files
+    auto encode_table = build_encode_table(public_key_dec);
+    std::cout << "Encode table: " << encode_table.sums.size() << " subset sums, "
+              << encode_table_memory(encode_table) / 1024 << " KiB" << std::endl;
 
+    // Decimal export of the keys
     std::ofstream p_file("p.txt");
     std::ofstream q_file("q.txt");
     std::ofstream private_key_file("private_key.txt");
@@ -324,21 +535,27 @@ int main() {
 
             int padding = 0;
             auto hex_out_filename = std::string(OUTPUT_DIR).append(filename).append("_decrypted_hexoutput.txt");
-            auto encoded_filepath = std::string(OUTPUT_DIR).append(filename).append("_encrypted_output.txt");
+            auto encoded_filepath = std::string(OUTPUT_DIR).append(filename).append("_encrypted_output.bin");
+            auto encoded_text_filepath = std::string(OUTPUT_DIR).append(filename).append("_encrypted_output.txt");
             auto decoded_filepath = std::string(DECODED_DIR).append(filename).append(".").append(extension);
 
             // Encoding
             std::cout << "Encrypting file " << filepath << std::endl;
-            auto encoded_decimals = encode(input_bytes, public_key_dec, &padding);
-            if (!encoded_decimals.empty()) {
-                std::ofstream output(encoded_filepath);
-                for (auto &dec : encoded_decimals)
-                    output << dec << std::endl;
-            }
+            auto encoded_decimals = encode(input_bytes, encode_table, &padding);
+            if (!save_container(encoded_filepath, ContainerKind::CIPHERTEXT, KEY_SIZE, padding, encoded_decimals))
+                continue;
+            // Decimal export of the ciphertext
+            std::ofstream output(encoded_text_filepath);
+            for (auto &dec : encoded_decimals)
+                output << dec << std::endl;
+            output.close();
 
             // Decoding
             std::cout << "Decrypting file " << encoded_filepath << std::endl;
-            auto decoded_bytes = decode(encoded_decimals, private_key_dec, p_inverse, q, padding);
+            MappedContainer<int32_t, UNLIMITED> ciphertext(encoded_filepath, ContainerKind::CIPHERTEXT);
+            if (!ciphertext.isOpen())
+                continue;
+            auto decoded_bytes = decode(ciphertext, private_key_dec, p_inverse, q);
             if (!decoded_bytes.empty()) {
                 std::ofstream decoded(decoded_filepath, std::ios::binary);
                 decoded.write((char *) decoded_bytes.data(), static_cast<int>(decoded_bytes.size()));
@@ -0,0 +1,158 @@
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <limits>
+#include <string>
+#include "my_big_int.h"
+
+/** Operand sizes (in digits) the crossovers are searched in */
+constexpr size_t MIN_SIZE = 8;
+/** Operand sizes (in digits) the crossovers are searched in */
+constexpr size_t MAX_SIZE = 4096;
+/** Operand sizes (in digits) the crossover of the number theoretic transform is searched in */
+constexpr size_t NTT_MIN_SIZE = 256;
+/** Operand sizes (in digits) the crossover of the number theoretic transform is searched in */
+constexpr size_t NTT_MAX_SIZE = 65536;
+/** Minimal measured time of one trial (in seconds) */
+constexpr double MIN_TIME = 0.02;
+/** Number of trials of one configuration, the fastest one is taken (the others are disturbed by the system) */
+constexpr int TRIALS = 5;
+/** Threshold that is never reached (the algorithm is disabled) */
+constexpr size_t DISABLED = std::numeric_limits<size_t>::max();
+
+/**
+ * Measures the time of one multiplication of two random numbers with the given number of digits
+ * @param size Number of digits of both operands
+ * @param thresholds Thresholds of the algorithms
+ * @param gen Random generator
+ * @tparam Limbs Base of the digits
+ * @return Time of one multiplication in seconds (the fastest of all trials)
+ */
+template<LimbBackend Limbs>
+double time_mul(size_t size, const MulThresholds &thresholds, std::mt19937_64 &gen) {
+    std::vector<uint32_t> num1(size), num2(size), result(2 * size);
+    for (size_t i = 0; i < size; i++) {
+        num1[i] = gen() % Limbs::BASE;
+        num2[i] = gen() % Limbs::BASE;
+    }
+    std::vector<uint32_t> scratch(mul_scratch_size(size, thresholds));
+
+    double best = std::numeric_limits<double>::max();
+    for (int trial = 0; trial < TRIALS; trial++) {
+        int repetitions = 0;
+        std::chrono::duration<double> elapsed{0};
+        do {
+            auto start = std::chrono::steady_clock::now();
+            mul_limbs<Limbs>(num1.data(), size, num2.data(), size, result.data(), scratch.data(), thresholds);
+            elapsed += std::chrono::steady_clock::now() - start;
+            repetitions++;
+        } while (elapsed.count() < MIN_TIME);
+        best = std::min(best, elapsed.count() / repetitions);
+    }
+
+    return best;
+}
+
+/**
+ * Finds the threshold of the faster algorithm used on the top level
+ * The slower thresholds describe the multiplication without the new algorithm, the faster thresholds get the size
+ * as the threshold of the new algorithm, so only the top level is changed
+ * Single measurements are noisy, so the threshold is the split of the measured sizes with the smallest total time
+ * (slower algorithm below the threshold, faster algorithm from the threshold up)
+ * @param name Name of the algorithm (printed)
+ * @param slower Thresholds without the algorithm
+ * @param faster Function setting the threshold of the algorithm
+ * @param gen Random generator
+ * @param min_size Smallest measured size
+ * @param max_size Biggest measured size
+ * @tparam Limbs Base of the digits
+ * @return Threshold of the algorithm (DISABLED if it never pays off)
+ */
+template<LimbBackend Limbs, typename F>
+size_t find_crossover(const std::string &name, const MulThresholds &slower, F faster, std::mt19937_64 &gen,
+                      size_t min_size = MIN_SIZE, size_t max_size = MAX_SIZE) {
+    std::vector<size_t> sizes;
+    std::vector<double> times_slower, times_faster;
+    for (size_t size = min_size; size <= max_size; size += size / 4) {
+        auto thresholds = slower;
+        faster(thresholds, size);
+        sizes.push_back(size);
+        times_slower.push_back(time_mul<Limbs>(size, slower, gen));
+        times_faster.push_back(time_mul<Limbs>(size, thresholds, gen));
+        std::cout << "  " << size << " digits: without " << name << " " << times_slower.back() * 1e6
+                  << " us, with " << name << " " << times_faster.back() * 1e6 << " us" << std::endl;
+    }
+
+    // Relative times, so the biggest sizes don't outweigh all the others
+    size_t crossover = DISABLED;
+    // Split after the last size (the faster algorithm is never used) is the starting point
+    auto best = static_cast<double>(sizes.size());
+    for (size_t split = 0; split < sizes.size(); split++) {
+        double total = 0;
+        for (size_t i = 0; i < sizes.size(); i++)
+            total += i < split ? 1 : times_faster[i] / times_slower[i];
+        if (total < best) {
+            best = total;
+            crossover = sizes[split];
+        }
+    }
+    return crossover;
+}
+
+/**
+ * Tunes the thresholds for one base of the digits
+ * @param name Name of the base (printed)
+ * @param gen Random generator
+ * @tparam Limbs Base of the digits
+ * @return Tuned thresholds
+ */
+template<LimbBackend Limbs>
+MulThresholds tune(const std::string &name, std::mt19937_64 &gen) {
+    std::cout << name << ": schoolbook vs Karatsuba" << std::endl;
+    auto karatsuba = find_crossover<Limbs>("Karatsuba", {DISABLED, DISABLED, DISABLED},
+                                           [](MulThresholds &t, size_t size) { t.karatsuba = size; }, gen);
+    std::cout << name << ": Karatsuba vs Toom-3" << std::endl;
+    auto toom3 = find_crossover<Limbs>("Toom-3", {karatsuba, DISABLED, DISABLED},
+                                       [](MulThresholds &t, size_t size) { t.toom3 = size; }, gen);
+    std::cout << name << ": Toom-3 vs NTT" << std::endl;
+    auto ntt = find_crossover<Limbs>("NTT", {karatsuba, toom3, DISABLED},
+                                     [](MulThresholds &t, size_t size) { t.ntt = size; }, gen,
+                                     NTT_MIN_SIZE, NTT_MAX_SIZE);
+    // NTT paying off before Toom-3 leaves Toom-3 only the products longer than NTT_MAX_LENGTH
+    return {karatsuba, std::min(toom3, ntt), ntt};
+}
+
+/**
+ * Prints the thresholds in the form of the MUL_THRESHOLDS constant of a limb backend
+ * @param backend Name of the limb backend
+ * @param thresholds Thresholds
+ */
+void print_thresholds(const std::string &backend, const MulThresholds &thresholds) {
+    auto value = [](size_t threshold) { return threshold == DISABLED ? "SIZE_MAX" : std::to_string(threshold); };
+    std::cout << backend << ": static constexpr MulThresholds MUL_THRESHOLDS = {" << value(thresholds.karatsuba)
+              << ", " << value(thresholds.toom3) << ", " << value(thresholds.ntt) << "};" << std::endl;
+}
+
+/**
+ * Main function
+ * Measures the crossovers of the multiplication algorithms in my_big_int.h for both bases and prints the thresholds
+ * for MUL_THRESHOLDS of DecimalLimbs and BinaryLimbs
+ * Usage: mul_tuning
+ * @return 0 if successful
+ */
+int main() {
+    // Fixed seed, so all runs measure the same numbers
+    std::mt19937_64 gen(42);
+    auto decimal = tune<DecimalLimbs>("Base 10^9", gen);
+    auto binary = tune<BinaryLimbs>("Base 2^32", gen);
+
+    std::cout << "Base 10^9: Karatsuba from " << decimal.karatsuba << " digits, Toom-3 from " << decimal.toom3
+              << " digits, NTT from " << decimal.ntt << " digits" << std::endl;
+    std::cout << "Base 2^32: Karatsuba from " << binary.karatsuba << " digits, Toom-3 from " << binary.toom3
+              << " digits, NTT from " << binary.ntt << " digits" << std::endl;
+    print_thresholds("DecimalLimbs", decimal);
+    print_thresholds("BinaryLimbs", binary);
+
+    return EXIT_SUCCESS;
+}
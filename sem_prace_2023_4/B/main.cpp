@@ -2,7 +2,7 @@
 #include <fstream>
 #include <chrono>
 #include <thread>
-#include "biginteger.h"
+#include "bignum_biginteger.h"
 
 // https://github.com/qiray/BigInteger
 
@@ -28,7 +28,7 @@ BigInteger dh_bf_attack(const BigInteger& p, const BigInteger& g, const BigInteg
     BigInteger g_pow_x_mod_p = 1;
     while (g_pow_x_mod_p != g_pow_pkey_mod_p) {
         x++;
-        g_pow_x_mod_p = (g_pow_x_mod_p * g) % p;
+        g_pow_x_mod_p = mod_mul(g_pow_x_mod_p, g, p);
     }
     return x;
 }
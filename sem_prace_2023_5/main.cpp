@@ -1,43 +1,21 @@
 #include <iostream>
 #include <string>
-#include <random>
-#include <chrono>
 #include <algorithm>
 #include <fstream>
 #include "sha256.h"
-#include "biginteger.h"
+#include "bignum_biginteger.h"
+#include "csprng.h"
 
 /** String to hash and later sign */
 constexpr std::string_view A20B0279P = "A20B0279P";
 
-/**
- * Checks if a number is prime and bigger than 2
- * @param n Number to check
- * @return True if the number is prime and bigger than 2, false otherwise
- */
-bool is_prime_and_bigger_than_two(int n) {
-    if (n <= 2)
-        return false;
-    if (n % 2 == 0 || n % 3 == 0)
-        return false;
-    for (int i = 5; i * i <= n; i += 6)
-        if (n % i == 0 || n % (i + 2) == 0)
-            return false;
-    return true;
-}
-
 /**
  * Generates a random prime number between 3 and upper_limit
  * @param upper_limit Upper limit of the random number
  * @return Random prime number between 3 and upper_limit
  */
 int gen_prime(int upper_limit=INT32_MAX) {
-    std::default_random_engine gen(std::chrono::system_clock::now().time_since_epoch().count());
-    std::uniform_int_distribution<int> dist(0, upper_limit);
-    int res = dist(gen);
-    while (!is_prime_and_bigger_than_two(res))
-        res = dist(gen);
-    return res;
+    return static_cast<int>(random_prime(upper_limit));
 }
 
 /**
@@ -46,74 +24,7 @@ int gen_prime(int upper_limit=INT32_MAX) {
  * @return Random number between 0 and p - 1
  */
 int gen_random_smaller_than_p(int p) {
-    std::default_random_engine gen(std::chrono::system_clock::now().time_since_epoch().count());
-    std::uniform_int_distribution<int> dist(0, p - 1);
-    return dist(gen);
-}
-
-/**
- * Non recursive implementation of the extended euclidean algorithm
- * @param a Number to find the multiplicative inverse of
- * @param b Modulo number (the number to find the multiplicative inverse of a modulo b)
- * @return Multiplicative inverse of a modulo b
- */
-int find_multiplicative_inverse(int a, int b) {
-    int t = 0, new_t = 1, r = b, new_r = a;
-    while (new_r != 0) {
-        int quotient = r / new_r;
-        int temp = t;
-        t = new_t;
-        new_t = temp - quotient * new_t;
-        temp = r;
-        r = new_r;
-        new_r = temp - quotient * new_r;
-    }
-    t += b;
-    return t;
-}
-
-/**
- * Calculates the modular exponentiation of a number
- * @param base Base number
- * @param exponent Exponent
- * @param modulus Modulus
- * @return Modular exponentiation of base^exponent mod modulus
- */
-BigInteger mod_pow(BigInteger base, BigInteger exponent, BigInteger modulus){
-    BigInteger result = 1;
-    while (exponent > 0){
-        if (exponent % 2 == 1)
-            result = (result * base) % modulus;
-        exponent = exponent >> 1;
-        base = (base * base) % modulus;
-    }
-    return result;
-}
-
-/**
- * Parses a hash string to a vector of bytes
- * @param hash Hash string
- * @return Vector of bytes
- */
-std::vector<int> get_hash_bytes(const std::string &hash) {
-    std::vector<int> res;
-    for (int i = 0; i < hash.size(); i += 2) {
-        std::string hex = hash.substr(i, 2);
-        res.push_back(std::stoi(hex, nullptr, 16));
-    }
-    return res;
-}
-
-/**
- * Sums the bytes of a hash into a single decimal number
- * @param hex_bytes Vector of bytes
- * @return Decimal number
- */
-BigInteger hex_to_dec(const std::vector<int> &hex_bytes) {
-    BigInteger res = 0;
-    for (int i = 0; i < hex_bytes.size(); i++)
-        res += BigInteger(hex_bytes[i]) * pow(BigInteger(256), BigInteger(hex_bytes.size() - i - 1));
-    return res;
+    return static_cast<int>(random_below(static_cast<uint32_t>(p)));
 }
 
 /**
@@ -152,7 +63,7 @@ int gen_x(int p) {
 int gen_y(int g, int x, int p) {
     BigInteger big_x = BigInteger(x);
     BigInteger big_g = BigInteger(g);
-    BigInteger big_y = mod_pow(big_g, big_x, p);
+    BigInteger big_y = mod_pow(big_g, big_x, BigInteger(p));
     int y = static_cast<int>(big_y.toUint());
     return y % p;
 }
@@ -166,16 +77,20 @@ int gen_y(int g, int x, int p) {
  * @return Pair of numbers (a, b) as the signature of the message
  */
 std::pair<BigInteger, BigInteger> sign(BigInteger message, int p, int g, int x) {
-    int k = gen_prime(p - 1);
+    // Prime k is coprime with p - 1 unless it divides it (then k has no inverse)
+    int k;
+    do {
+        k = gen_prime(p - 1);
+    } while ((p - 1) % k == 0);
     std::ofstream k_file("k.txt");
     std::cout << "k = " << k << std::endl;
     k_file << k;
     k_file.close();
 
-    BigInteger a = mod_pow(g, k, p);
+    BigInteger a = mod_pow(BigInteger(g), BigInteger(k), BigInteger(p));
     std::cout << "a = " << a << std::endl;
 
-    int k_inv = find_multiplicative_inverse(k, p - 1);
+    BigInteger k_inv = mod_inverse(BigInteger(k), BigInteger(p - 1));
     auto temp = (message - x * a);
     if (temp < 0) {
         temp %= (p - 1);
@@ -203,10 +118,11 @@ bool verify(BigInteger message, std::pair<BigInteger, BigInteger> &signature, in
     BigInteger a = signature.first;
     BigInteger b = signature.second;
 
-    BigInteger left = mod_pow(y, a, p) * mod_pow(a, b, p) % p;
+    const BigInteger modulus(p);
+    BigInteger left = mod_mul(mod_pow(BigInteger(y), a, modulus), mod_pow(a, b, modulus), modulus);
     std::cout << "y^a * a^b mod p = " << left << std::endl;
 
-    BigInteger right = mod_pow(g, message, p);
+    BigInteger right = mod_pow(BigInteger(g), message, modulus);
     std::cout << "g^message mod p = " << right << std::endl;
 
     return left == right;
@@ -219,8 +135,7 @@ bool verify(BigInteger message, std::pair<BigInteger, BigInteger> &signature, in
 int main() {
     auto hash = sha256(A20B0279P.data());
     std::cout << A20B0279P << " -> " << hash << std::endl;
-    auto hash_bytes = get_hash_bytes(hash);
-    auto hash_num = hex_to_dec(hash_bytes);
+    auto hash_num = from_radix_string<BigInteger>(hash, 16);
     std::cout << "Hash as decimal number: " << hash_num << std::endl;
 
     std::cout << std::endl << "Generating parameters:" << std::endl;